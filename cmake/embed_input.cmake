@@ -0,0 +1,20 @@
+# Writes OUTPUT, the header holding the bytes of INPUT, the input.txt of the day DAY, for the
+# AOC_EMBED_INPUTS option:
+#   cmake -DDAY=day01 -DINPUT=day01/input.txt -DOUTPUT=embedded_input.hpp -P embed_input.cmake
+
+file(READ ${INPUT} bytes HEX)
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "'\\\\x\\1'," bytes "${bytes}")
+file(WRITE ${OUTPUT} "// Generated from ${INPUT} by cmake/embed_input.cmake
+
+#pragma once
+
+#include <string_view>
+
+namespace aoc::embedded {
+
+constexpr std::string_view day{\"${DAY}\"};
+constexpr char bytes[] = {${bytes}'\\0'};
+constexpr std::string_view text{bytes, sizeof(bytes) - 1};
+
+}  // namespace aoc::embedded
+")
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+
+#include "counters.hpp"
+
+namespace aoc {
+
+// Monotonic memory resource for the node-based containers of a solve: deallocation is a no-op and
+// everything is freed at once by reset(). The first block grows to the largest footprint seen so
+// far, so an arena that is reset between regions or search levels stops calling malloc.
+class Arena : public std::pmr::memory_resource {
+ public:
+  explicit Arena(std::size_t initial_size = 64UZ * 1024UZ)
+      : capacity_{initial_size},
+        buffer_{std::make_unique_for_overwrite<std::byte[]>(capacity_)},
+        resource_{std::in_place, buffer_.get(), capacity_} {}
+  Arena(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+  auto operator=(const Arena&) -> Arena& = delete;
+  auto operator=(Arena&&) -> Arena& = delete;
+  ~Arena() override = default;
+
+  // Frees every allocation. The containers using the arena must have been destroyed.
+  auto reset() {
+    resource_.reset();
+    if (high_water_ > capacity_) {
+      capacity_ = std::bit_ceil(high_water_);
+      buffer_ = std::make_unique_for_overwrite<std::byte[]>(capacity_);
+    }
+    resource_.emplace(buffer_.get(), capacity_);
+    used_ = 0UZ;
+  }
+
+  // Bytes handed out since the last reset, and the most ever handed out
+  auto used() const { return used_; }
+  auto high_water() const { return high_water_; }
+
+  // The most bytes in use since the previous call, resets included
+  auto take_peak() { return std::exchange(peak_, 0UZ); }
+
+ private:
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+    used_ += bytes;
+    high_water_ = std::max(high_water_, used_);
+    peak_ = std::max(peak_, used_);
+    return resource_->allocate(bytes, alignment);
+  }
+
+  auto do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/)
+      -> void override {}
+
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+    return this == &other;
+  }
+
+  std::size_t capacity_;
+  std::unique_ptr<std::byte[]> buffer_;
+  std::optional<std::pmr::monotonic_buffer_resource> resource_;
+  std::size_t used_{};
+  std::size_t high_water_{};
+  std::size_t peak_{};
+};
+
+// Arenas of the calling thread, kept from one solve to the next so that a thread solving many
+// inputs in a row stops allocating their blocks. A solve picks them by index, a different one for
+// each arena it uses at the same time, and resets them before use.
+inline constexpr auto thread_arena_count = 3UZ;
+
+inline auto thread_arena(std::size_t index) -> Arena& {
+  thread_local std::array<Arena, thread_arena_count> arenas;
+  return arenas.at(index);
+}
+
+// Reports the most bytes the arenas held while it lived as the "arena bytes" counter of the
+// current phase, however many times they were reset in between
+class ArenaUsage {
+ public:
+  ArenaUsage(std::initializer_list<Arena*> arenas) {
+    assert(arenas.size() <= arenas_.size());
+    std::ranges::copy(arenas, arenas_.begin());
+    for (Arena* arena : arenas) {
+      arena->take_peak();
+    }
+  }
+  ArenaUsage(const ArenaUsage&) = delete;
+  ArenaUsage(ArenaUsage&&) = delete;
+  auto operator=(const ArenaUsage&) -> ArenaUsage& = delete;
+  auto operator=(ArenaUsage&&) -> ArenaUsage& = delete;
+  ~ArenaUsage() {
+    for (Arena* arena : arenas_) {
+      if (arena != nullptr) {
+        AOC_COUNT_MAX("arena bytes", arena->take_peak());
+      }
+    }
+  }
+
+ private:
+  std::array<Arena*, thread_arena_count> arenas_{};
+};
+
+}  // namespace aoc
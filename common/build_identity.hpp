@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <system_error>
+
+#include "flat_hash.hpp"
+
+namespace aoc {
+
+// Identifies the running build by its executable (path, size and modification time), so that the
+// files derived from what a build computed are not trusted by another build. Nothing if the
+// executable cannot be found.
+inline auto build_identity() -> std::optional<std::uint64_t> {
+  static const auto identity = []() -> std::optional<std::uint64_t> {
+    std::error_code error;
+    const auto executable = std::filesystem::read_symlink("/proc/self/exe", error);
+    if (error) {
+      return std::nullopt;
+    }
+    const auto size = std::filesystem::file_size(executable, error);
+    if (error) {
+      return std::nullopt;
+    }
+    const auto modified = std::filesystem::last_write_time(executable, error);
+    if (error) {
+      return std::nullopt;
+    }
+    return hash_combine(hash_combine(Hash{}(executable.native()), size),
+                        modified.time_since_epoch().count());
+  }();
+  return identity;
+}
+
+}  // namespace aoc
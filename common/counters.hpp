@@ -0,0 +1,200 @@
+#pragma once
+
+// Work counters for the hot loops, e.g. AOC_COUNT("queue pushes", 1), grouped by the phase that
+// is running on the calling thread. They compile to nothing unless AOC_ENABLE_COUNTERS is defined,
+// in which case a table of every phase is printed to stderr at exit.
+
+#include <string_view>
+
+#if defined(AOC_ENABLE_COUNTERS)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <print>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aoc::counters {
+
+enum class Kind : std::uint8_t {
+  sum,
+  high_water,
+};
+
+struct Definition {
+  std::string_view name;
+  Kind kind;
+};
+
+struct Totals {
+  std::size_t runs{};
+  std::vector<std::uint64_t> values;  // Indexed by counter id
+};
+
+class Registry {
+ public:
+  Registry() = default;
+  Registry(const Registry&) = delete;
+  Registry(Registry&&) = delete;
+  auto operator=(const Registry&) -> Registry& = delete;
+  auto operator=(Registry&&) -> Registry& = delete;
+  ~Registry() { print(); }
+
+  auto id_of(std::string_view name, Kind kind) -> std::size_t {
+    const std::scoped_lock lock{mutex_};
+    const auto it = std::ranges::find(definitions_, name, &Definition::name);
+    if (it != definitions_.end()) {
+      return std::size_t(it - definitions_.begin());
+    }
+    definitions_.push_back(Definition{.name = name, .kind = kind});
+    return definitions_.size() - 1UZ;
+  }
+
+  auto merge(const std::string& phase, const std::vector<std::uint64_t>& values,
+             std::size_t runs = 1UZ) {
+    const std::scoped_lock lock{mutex_};
+    auto& totals = phases_[phase];
+    totals.runs += runs;
+    totals.values.resize(std::max(totals.values.size(), values.size()));
+    for (std::size_t id{}; id != values.size(); ++id) {
+      auto& total = totals.values[id];
+      total = definitions_[id].kind == Kind::sum ? total + values[id] : std::max(total, values[id]);
+    }
+  }
+
+ private:
+  auto print() const -> void {
+    if (phases_.empty()) {
+      return;
+    }
+    std::println(stderr, "{:<16} {:<24} {:>6} {:>16} {:>16}", "phase", "counter", "runs", "total",
+                 "per run");
+    for (const auto& [phase, totals] : phases_) {
+      for (std::size_t id{}; id != totals.values.size(); ++id) {
+        if (totals.values[id] == 0U) {
+          continue;
+        }
+        const auto& [name, kind] = definitions_[id];
+        const auto per_run =
+            kind == Kind::sum ? totals.values[id] / totals.runs : totals.values[id];
+        std::println(stderr, "{:<16} {:<24} {:>6} {:>16} {:>16}", phase, name, totals.runs,
+                     totals.values[id], per_run);
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::vector<Definition> definitions_;
+  std::map<std::string, Totals> phases_;
+};
+
+inline auto registry() -> Registry& {
+  static Registry result;
+  return result;
+}
+
+// Counts of the phase running on this thread, merged into the registry when it ends
+struct Current {
+  std::string phase{"-"};
+  std::vector<std::uint64_t> values;
+};
+
+inline auto current() -> Current& {
+  thread_local Current result;
+  return result;
+}
+
+inline auto add(std::size_t id, std::uint64_t amount) {
+  auto& values = current().values;
+  if (id >= values.size()) {
+    values.resize(id + 1UZ);
+  }
+  values[id] += amount;
+}
+
+inline auto raise(std::size_t id, std::uint64_t value) {
+  auto& values = current().values;
+  if (id >= values.size()) {
+    values.resize(id + 1UZ);
+  }
+  values[id] = std::max(values[id], value);
+}
+
+class Phase {
+ public:
+  Phase(std::string_view day, std::string_view phase) {
+    registry();  // Constructed first, so destroyed after the last phase ended
+    auto& state = current();
+    std::swap(outer_, state);
+    state.phase = std::string{day} + ' ' + std::string{phase};
+  }
+  Phase(const Phase&) = delete;
+  Phase(Phase&&) = delete;
+  auto operator=(const Phase&) -> Phase& = delete;
+  auto operator=(Phase&&) -> Phase& = delete;
+  ~Phase() {
+    auto& state = current();
+    registry().merge(state.phase, state.values);
+    std::swap(outer_, state);
+  }
+
+ private:
+  Current outer_;
+};
+
+// Counts of a thread helping with a phase running on another one, e.g. a worker of a parallel
+// loop, which are added to the phase without counting a run
+class Assist {
+ public:
+  explicit Assist(const std::string& phase) {
+    auto& state = current();
+    std::swap(outer_, state);
+    state.phase = phase;
+  }
+  Assist(const Assist&) = delete;
+  Assist(Assist&&) = delete;
+  auto operator=(const Assist&) -> Assist& = delete;
+  auto operator=(Assist&&) -> Assist& = delete;
+  ~Assist() {
+    auto& state = current();
+    registry().merge(state.phase, state.values, 0UZ);
+    std::swap(outer_, state);
+  }
+
+ private:
+  Current outer_;
+};
+
+}  // namespace aoc::counters
+
+#define AOC_COUNTER_UPDATE(update, name, kind, amount)                                            \
+  do {                                                                                            \
+    static const std::size_t aoc_counter_id = ::aoc::counters::registry().id_of(name, kind);      \
+    ::aoc::counters::update(aoc_counter_id, std::uint64_t(amount));                               \
+  } while (false)
+
+#define AOC_COUNT(name, amount) \
+  AOC_COUNTER_UPDATE(add, name, ::aoc::counters::Kind::sum, amount)
+#define AOC_COUNT_MAX(name, value) \
+  AOC_COUNTER_UPDATE(raise, name, ::aoc::counters::Kind::high_water, value)
+
+#else
+
+namespace aoc::counters {
+
+class Phase {
+ public:
+  Phase(std::string_view /*day*/, std::string_view /*phase*/) {}
+};
+
+}  // namespace aoc::counters
+
+#define AOC_COUNT(name, amount) static_cast<void>(sizeof(amount))
+#define AOC_COUNT_MAX(name, value) static_cast<void>(sizeof(value))
+
+#endif
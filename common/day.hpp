@@ -0,0 +1,219 @@
+#pragma once
+
+#include <any>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "counters.hpp"
+#include "flat_hash.hpp"
+#include "input.hpp"
+#include "snapshot.hpp"
+#include "trace.hpp"
+
+namespace aoc {
+
+// Type-erased puzzle solver, so that drivers can run any day in-process
+class Day {
+ public:
+  explicit Day(std::string_view name) : name_{name} {}
+  Day(const Day&) = delete;
+  Day(Day&&) = delete;
+  auto operator=(const Day&) -> Day& = delete;
+  auto operator=(Day&&) -> Day& = delete;
+  virtual ~Day() = default;
+
+  auto name() const { return name_; }
+
+  virtual auto has_analysis() const -> bool = 0;
+  virtual auto has_part2() const -> bool = 0;
+  // Whether the parsed input can be saved to and loaded from a binary snapshot
+  virtual auto has_snapshot() const -> bool = 0;
+  virtual auto parse(std::string_view text) const -> std::any = 0;
+  virtual auto save_snapshot(const std::any& input, SnapshotWriter& writer) const -> void = 0;
+  // Empty if the snapshot was made by a different input type or is corrupt
+  virtual auto load_snapshot(SnapshotReader& reader) const -> std::any = 0;
+  // Work shared by both parts, done once on the parsed input. Empty for the days without one.
+  virtual auto analyze(const std::any& input) const -> std::any = 0;
+  virtual auto solve_part1(const std::any& input, const std::any& analysis) const
+      -> std::string = 0;
+  virtual auto solve_part2(const std::any& input, const std::any& analysis) const
+      -> std::optional<std::string> = 0;
+
+ private:
+  std::string_view name_;
+};
+
+// A null Analyze means the parts only take the input, a null Part2 that there is no part 2
+template <typename Parse, typename Analyze, typename Part1, typename Part2>
+class Solution final : public Day {
+  using Input = std::remove_cvref_t<std::invoke_result_t<const Parse&, std::string_view>>;
+
+ public:
+  Solution(std::string_view name, Parse parse, Analyze analyze, Part1 part1, Part2 part2)
+      : Day{name},
+        parse_{std::move(parse)},
+        analyze_{std::move(analyze)},
+        part1_{std::move(part1)},
+        part2_{std::move(part2)} {}
+
+  auto has_analysis() const -> bool override { return !std::is_null_pointer_v<Analyze>; }
+  auto has_part2() const -> bool override { return !std::is_null_pointer_v<Part2>; }
+  auto has_snapshot() const -> bool override {
+    return Snapshottable<Input> && std::endian::native == std::endian::little;
+  }
+
+  auto parse(std::string_view text) const -> std::any override {
+    const counters::Phase phase{name(), "parse"};
+    const trace::Span span{"parse", name()};
+    return parse_(text);
+  }
+
+  auto save_snapshot(const std::any& input, SnapshotWriter& writer) const -> void override {
+    if constexpr (Snapshottable<Input>) {
+      writer.write(schema());
+      Snapshot<Input>::save(writer, std::any_cast<const Input&>(input));
+    }
+  }
+
+  auto load_snapshot(SnapshotReader& reader) const -> std::any override {
+    if constexpr (Snapshottable<Input>) {
+      const counters::Phase phase{name(), "snapshot"};
+      const trace::Span span{"snapshot", name()};
+      if (reader.read<std::uint64_t>() != schema()) {
+        return {};
+      }
+      auto input = Snapshot<Input>::load(reader);
+      if (reader.ok() && reader.at_end()) {
+        return input;
+      }
+    }
+    return {};
+  }
+
+  auto analyze(const std::any& input) const -> std::any override {
+    if constexpr (std::is_null_pointer_v<Analyze>) {
+      return {};
+    } else {
+      const counters::Phase phase{name(), "analysis"};
+      const trace::Span span{"analysis", name()};
+      return analyze_(std::any_cast<const Input&>(input));
+    }
+  }
+
+  auto solve_part1(const std::any& input, const std::any& analysis) const
+      -> std::string override {
+    const counters::Phase phase{name(), "part1"};
+    const trace::Span span{"part1", name()};
+    return std::format("{}", solve(part1_, input, analysis));
+  }
+
+  auto solve_part2(const std::any& input, const std::any& analysis) const
+      -> std::optional<std::string> override {
+    if constexpr (std::is_null_pointer_v<Part2>) {
+      return std::nullopt;
+    } else {
+      const counters::Phase phase{name(), "part2"};
+      const trace::Span span{"part2", name()};
+      return std::format("{}", solve(part2_, input, analysis));
+    }
+  }
+
+ private:
+  auto solve(const auto& part, const std::any& input, const std::any& analysis) const {
+    if constexpr (std::is_null_pointer_v<Analyze>) {
+      return part(std::any_cast<const Input&>(input));
+    } else {
+      using Analysis = std::remove_cvref_t<std::invoke_result_t<const Analyze&, const Input&>>;
+      return part(std::any_cast<const Input&>(input), std::any_cast<const Analysis&>(analysis));
+    }
+  }
+
+  // Tells apart the snapshots of different input types
+  static auto schema() -> std::uint64_t {
+    return hash_combine(Hash{}(std::string_view{typeid(Input).name()}), sizeof(Input));
+  }
+
+  Parse parse_;
+  Analyze analyze_;
+  Part1 part1_;
+  Part2 part2_;
+};
+
+// Every day linked into the executable, in registration order
+inline auto registry() -> std::vector<std::unique_ptr<const Day>>& {
+  static std::vector<std::unique_ptr<const Day>> days;
+  return days;
+}
+
+inline auto find_day(std::string_view name) -> const Day* {
+  for (const auto& day : registry()) {
+    if (day->name() == name) {
+      return day.get();
+    }
+  }
+  return nullptr;
+}
+
+template <typename Parse, typename Part1, typename Part2 = std::nullptr_t>
+auto register_day(std::string_view name, Parse parse, Part1 part1, Part2 part2 = nullptr) {
+  registry().push_back(std::make_unique<const Solution<Parse, std::nullptr_t, Part1, Part2>>(
+      name, std::move(parse), nullptr, std::move(part1), std::move(part2)));
+  return true;
+}
+
+// For days whose parts share work: both take the input and what `analyze(input)` returned
+template <typename Parse, typename Analyze, typename Part1, typename Part2 = std::nullptr_t>
+auto register_analyzed_day(std::string_view name, Parse parse, Analyze analyze, Part1 part1,
+                           Part2 part2 = nullptr) {
+  registry().push_back(std::make_unique<const Solution<Parse, Analyze, Part1, Part2>>(
+      name, std::move(parse), std::move(analyze), std::move(part1), std::move(part2)));
+  return true;
+}
+
+// Parsed input of `day`, from the text file at `path`. With `use_snapshot` it is loaded from the
+// binary snapshot next to the file when the snapshot is still fresh, and the snapshot is rewritten
+// otherwise. Nothing if the file cannot be read.
+inline auto read_input(const Day& day, const std::filesystem::path& path, bool use_snapshot = false)
+    -> std::optional<std::any> {
+  use_snapshot = use_snapshot && day.has_snapshot();
+  const auto snapshot_path = std::filesystem::path{path}.replace_extension(".snapshot");
+  // Taken before reading the text, so that a concurrent rewrite can only make the snapshot stale
+  const auto source = use_snapshot ? SnapshotSource::of(path) : std::nullopt;
+  if (source.has_value()) {
+    if (const auto snapshot = MappedFile::open(snapshot_path); snapshot.has_value()) {
+      const auto bytes = std::as_bytes(std::span{snapshot->text()});
+      if (const auto payload = snapshot_payload(bytes, *source); payload.has_value()) {
+        SnapshotReader reader{*payload};
+        if (auto input = day.load_snapshot(reader); input.has_value()) {
+          return input;
+        }
+      }
+    }
+  }
+
+  const auto file = MappedFile::open(path);
+  if (!file.has_value()) {
+    return std::nullopt;
+  }
+  auto input = day.parse(file->text());
+  if (source.has_value()) {
+    SnapshotWriter writer;
+    day.save_snapshot(input, writer);
+    write_snapshot_file(snapshot_path, *source, writer.bytes());
+  }
+  return input;
+}
+
+}  // namespace aoc
@@ -0,0 +1,79 @@
+#pragma once
+
+// Inputs compiled into the executables with the AOC_EMBED_INPUTS option, for deployments on a
+// fixed input: the drivers then neither read input.txt nor, for the days whose parsed input is
+// plain data, parse it, as those parse the embedded text at compile time.
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "day.hpp"
+
+namespace aoc {
+
+struct EmbeddedInput {
+  std::string_view text;
+  auto (*parsed)() -> std::any;  // Input made from its form parsed at compile time, if any
+};
+
+inline auto embedded_inputs() -> std::map<std::string_view, EmbeddedInput>& {
+  static std::map<std::string_view, EmbeddedInput> result;
+  return result;
+}
+
+inline auto register_embedded_text(std::string_view day, std::string_view text) {
+  embedded_inputs()[day].text = text;
+  return true;
+}
+
+inline auto register_embedded_parse(std::string_view day, auto (*parsed)()->std::any) {
+  embedded_inputs()[day].parsed = parsed;
+  return true;
+}
+
+inline auto embedded_text(std::string_view day) -> std::optional<std::string_view> {
+  const auto it = embedded_inputs().find(day);
+  if (it == embedded_inputs().end() || it->second.text.data() == nullptr) {
+    return std::nullopt;
+  }
+  return it->second.text;
+}
+
+// Parsed input of `day` compiled into the executable, nothing if there is none
+inline auto embedded_input(const Day& day) -> std::optional<std::any> {
+  const auto it = embedded_inputs().find(day.name());
+  if (it == embedded_inputs().end()) {
+    return std::nullopt;
+  }
+  if (it->second.parsed != nullptr) {
+    return it->second.parsed();
+  }
+  if (it->second.text.data() != nullptr) {
+    return day.parse(it->second.text);
+  }
+  return std::nullopt;
+}
+
+// The elements of the vector that `make` returns, evaluated at compile time, as an array
+template <auto make>
+consteval auto freeze() {
+  constexpr auto size = make().size();
+  std::array<typename decltype(make())::value_type, size> result{};
+  const auto values = make();
+  std::ranges::copy(values, result.begin());
+  return result;
+}
+
+// Copy of an array frozen at compile time, for the runtime form of the inputs
+template <typename T, std::size_t size>
+auto thaw(const std::array<T, size>& frozen) {
+  return std::vector<T>(frozen.begin(), frozen.end());
+}
+
+}  // namespace aoc
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "loc.hpp"
+
+namespace aoc {
+
+// Finalizer of splitmix64, which spreads every input bit over the whole word
+constexpr auto mix(std::uint64_t x) -> std::uint64_t {
+  x = (x ^ (x >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27U)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31U);
+}
+
+// Hash for the keys of the solvers: integers and enums, locations, strings and positions in
+// contiguous containers (pointers or iterators). Strings are hashed by 8-byte words.
+struct Hash {
+  using is_transparent = void;
+
+  template <typename T>
+    requires std::integral<T> || std::is_enum_v<T>
+  auto operator()(T value) const -> std::uint64_t {
+    return mix(std::uint64_t(value));
+  }
+
+  auto operator()(Loc loc) const -> std::uint64_t { return mix(pack(loc)); }
+
+  auto operator()(std::string_view text) const -> std::uint64_t {
+    std::uint64_t result = text.size();
+    std::size_t pos{};
+    for (; pos + 8UZ <= text.size(); pos += 8UZ) {
+      std::uint64_t word{};
+      std::memcpy(&word, text.data() + pos, 8UZ);
+      result = mix(result ^ word);
+    }
+    std::uint64_t tail{};
+    if (pos != text.size()) {
+      std::memcpy(&tail, text.data() + pos, text.size() - pos);
+    }
+    return mix(result ^ tail);
+  }
+
+  template <std::contiguous_iterator It>
+  auto operator()(It it) const -> std::uint64_t {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return mix(reinterpret_cast<std::uintptr_t>(std::to_address(it)));
+  }
+};
+
+// Folds the hash of `value` into `seed`, for hashing aggregates
+template <typename T>
+auto hash_combine(std::uint64_t seed, const T& value) -> std::uint64_t {
+  return mix(seed ^ (Hash{}(value) + 0x9e3779b97f4a7c15ULL));
+}
+
+namespace detail {
+
+template <typename Key>
+struct SetSlot {
+  using key_type = Key;
+  using value_type = Key;
+
+  static auto key(const value_type& value) -> const Key& { return value; }
+};
+
+template <typename Key, typename Mapped>
+struct MapSlot {
+  using key_type = Key;
+  using value_type = std::pair<const Key, Mapped>;
+
+  static auto key(const value_type& value) -> const Key& { return value.first; }
+};
+
+// Matches of one byte against a group of control bytes, as a bit mask
+class Group {
+ public:
+  static constexpr std::size_t size = 16UZ;
+
+  explicit Group(const std::int8_t* control) : control_{control} {}
+
+  auto match(std::int8_t byte) const -> std::uint32_t {
+#if defined(__SSE2__)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control_));
+    return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(byte))));
+#else
+    std::uint32_t result{};
+    for (std::size_t i{}; i != size; ++i) {
+      result |= std::uint32_t(control_[i] == byte) << i;
+    }
+    return result;
+#endif
+  }
+
+ private:
+  const std::int8_t* control_;
+};
+
+// Open-addressing table in the layout of SwissTable: one control byte per slot holds 7 bits of
+// the hash of its key, or marks it empty, so that a probe compares a whole group of slots with a
+// single SIMD instruction and only touches the slots whose bits match. Groups are probed
+// linearly. There is no erase, since the solvers only ever grow their tables.
+template <typename Slot, typename KeyHash, typename KeyEqual>
+class FlatTable {
+ public:
+  using key_type = Slot::key_type;
+  using value_type = Slot::value_type;
+  using size_type = std::size_t;
+
+  template <bool is_const>
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Slot::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<is_const, const value_type&, value_type&>;
+    using pointer = std::conditional_t<is_const, const value_type*, value_type*>;
+
+    Iterator() = default;
+    Iterator(const std::int8_t* control, pointer slot, pointer end)
+        : control_{control}, slot_{slot}, end_{end} {
+      skip_empty();
+    }
+
+    auto operator*() const -> reference { return *slot_; }
+    auto operator->() const -> pointer { return slot_; }
+    auto operator++() -> Iterator& {
+      ++control_;
+      ++slot_;
+      skip_empty();
+      return *this;
+    }
+    auto operator++(int) -> Iterator {
+      auto result = *this;
+      ++*this;
+      return result;
+    }
+    auto operator==(const Iterator& other) const -> bool { return slot_ == other.slot_; }
+
+   private:
+    auto skip_empty() -> void {
+      while (slot_ != end_ && *control_ == empty_slot) {
+        ++control_;
+        ++slot_;
+      }
+    }
+
+    const std::int8_t* control_{};
+    pointer slot_{};
+    pointer end_{};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatTable() = default;
+  FlatTable(const FlatTable& other) {
+    reserve(other.size());
+    for (const auto& value : other) {
+      insert_new(value);
+    }
+  }
+  FlatTable(FlatTable&& other) noexcept
+      : control_{std::exchange(other.control_, nullptr)},
+        slots_{std::exchange(other.slots_, nullptr)},
+        capacity_{std::exchange(other.capacity_, 0UZ)},
+        size_{std::exchange(other.size_, 0UZ)} {}
+  auto operator=(const FlatTable& other) -> FlatTable& {
+    if (this != &other) {
+      *this = FlatTable{other};
+    }
+    return *this;
+  }
+  auto operator=(FlatTable&& other) noexcept -> FlatTable& {
+    swap(other);
+    return *this;
+  }
+  ~FlatTable() {
+    clear();
+    deallocate();
+  }
+
+  auto swap(FlatTable& other) noexcept -> void {
+    std::swap(control_, other.control_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+  }
+  friend auto swap(FlatTable& left, FlatTable& right) noexcept -> void { left.swap(right); }
+
+  auto size() const { return size_; }
+  auto empty() const { return size_ == 0UZ; }
+
+  auto begin() { return iterator{control_, slots_, slots_ + capacity_}; }
+  auto end() { return iterator{nullptr, slots_ + capacity_, slots_ + capacity_}; }
+  auto begin() const { return const_iterator{control_, slots_, slots_ + capacity_}; }
+  auto end() const { return const_iterator{nullptr, slots_ + capacity_, slots_ + capacity_}; }
+
+  // Makes room for `count` elements without rehashing
+  auto reserve(std::size_t count) -> void {
+    const auto capacity = std::max(Group::size, std::bit_ceil(count + (count / 7UZ) + 1UZ));
+    if (capacity > capacity_) {
+      rehash(capacity);
+    }
+  }
+
+  // Destroys the elements but keeps the memory
+  auto clear() -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (auto& value : *this) {
+        std::destroy_at(&value);
+      }
+    }
+    std::fill_n(control_, capacity_, empty_slot);
+    size_ = 0UZ;
+  }
+
+  template <typename K>
+  auto find(const K& key) -> iterator {
+    const auto i = find_index(key, KeyHash{}(key));
+    return i == npos ? end() : iterator{control_ + i, slots_ + i, slots_ + capacity_};
+  }
+  template <typename K>
+  auto find(const K& key) const -> const_iterator {
+    const auto i = find_index(key, KeyHash{}(key));
+    return i == npos ? end() : const_iterator{control_ + i, slots_ + i, slots_ + capacity_};
+  }
+  template <typename K>
+  auto contains(const K& key) const -> bool {
+    return find_index(key, KeyHash{}(key)) != npos;
+  }
+
+ protected:
+  // Slot of `key`, constructed from `args` when the key is new
+  template <typename K, typename... Args>
+  auto emplace_key(const K& key, Args&&... args) -> std::pair<iterator, bool> {
+    const auto hash = KeyHash{}(key);
+    if (const auto i = find_index(key, hash); i != npos) {
+      return {iterator{control_ + i, slots_ + i, slots_ + capacity_}, false};
+    }
+    reserve(size_ + 1UZ);
+    const auto i = free_index(hash);
+    std::construct_at(slots_ + i, std::forward<Args>(args)...);
+    control_[i] = fingerprint(hash);
+    ++size_;
+    return {iterator{control_ + i, slots_ + i, slots_ + capacity_}, true};
+  }
+
+ private:
+  static constexpr std::int8_t empty_slot = std::numeric_limits<std::int8_t>::min();
+  static constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+  static auto fingerprint(std::uint64_t hash) { return std::int8_t(hash & 0x7fU); }
+
+  auto first_group(std::uint64_t hash) const { return std::size_t(hash >> 7U) * Group::size; }
+
+  template <typename K>
+  auto find_index(const K& key, std::uint64_t hash) const -> std::size_t {
+    if (capacity_ == 0UZ) {
+      return npos;
+    }
+    const auto mask = capacity_ - 1UZ;
+    for (auto group = first_group(hash) & mask;; group = (group + Group::size) & mask) {
+      const Group control{control_ + group};
+      for (auto hits = control.match(fingerprint(hash)); hits != 0U; hits &= hits - 1U) {
+        const auto i = group + std::size_t(std::countr_zero(hits));
+        if (KeyEqual{}(Slot::key(slots_[i]), key)) {
+          return i;
+        }
+      }
+      if (control.match(empty_slot) != 0U) {
+        return npos;
+      }
+    }
+  }
+
+  auto free_index(std::uint64_t hash) const -> std::size_t {
+    const auto mask = capacity_ - 1UZ;
+    for (auto group = first_group(hash) & mask;; group = (group + Group::size) & mask) {
+      if (const auto hits = Group{control_ + group}.match(empty_slot); hits != 0U) {
+        return group + std::size_t(std::countr_zero(hits));
+      }
+    }
+  }
+
+  auto insert_new(const value_type& value) -> void {
+    const auto hash = KeyHash{}(Slot::key(value));
+    const auto i = free_index(hash);
+    std::construct_at(slots_ + i, value);
+    control_[i] = fingerprint(hash);
+    ++size_;
+  }
+
+  auto rehash(std::size_t capacity) -> void {
+    assert(std::has_single_bit(capacity) && capacity >= Group::size);
+    FlatTable old;
+    swap(old);
+    control_ = std::allocator<std::int8_t>{}.allocate(capacity);
+    slots_ = std::allocator<value_type>{}.allocate(capacity);
+    capacity_ = capacity;
+    std::fill_n(control_, capacity_, empty_slot);
+    for (auto& value : old) {
+      const auto hash = KeyHash{}(Slot::key(value));
+      const auto i = free_index(hash);
+      std::construct_at(slots_ + i, std::move(value));
+      control_[i] = fingerprint(hash);
+      ++size_;
+    }
+  }
+
+  auto deallocate() -> void {
+    if (capacity_ != 0UZ) {
+      std::allocator<std::int8_t>{}.deallocate(control_, capacity_);
+      std::allocator<value_type>{}.deallocate(slots_, capacity_);
+    }
+  }
+
+  std::int8_t* control_{};
+  value_type* slots_{};
+  std::size_t capacity_{};  // Zero or a power of two no smaller than a group
+  std::size_t size_{};
+};
+
+}  // namespace detail
+
+// Unordered map with contiguous storage, for keys that are never needed in order
+template <typename Key, typename Mapped, typename KeyHash = Hash,
+          typename KeyEqual = std::equal_to<>>
+class FlatMap : public detail::FlatTable<detail::MapSlot<Key, Mapped>, KeyHash, KeyEqual> {
+ public:
+  using mapped_type = Mapped;
+
+  template <typename... Args>
+  auto try_emplace(const Key& key, Args&&... args) {
+    return this->emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  auto emplace(const Key& key, Args&&... args) {
+    return try_emplace(key, std::forward<Args>(args)...);
+  }
+
+  auto operator[](const Key& key) -> Mapped& { return try_emplace(key).first->second; }
+};
+
+// Unordered set with contiguous storage, for keys that are never needed in order
+template <typename Key, typename KeyHash = Hash, typename KeyEqual = std::equal_to<>>
+class FlatSet : public detail::FlatTable<detail::SetSlot<Key>, KeyHash, KeyEqual> {
+ public:
+  auto insert(const Key& key) { return this->emplace_key(key, key); }
+};
+
+}  // namespace aoc
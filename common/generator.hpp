@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "loc.hpp"
+
+namespace aoc {
+
+// Deterministic pseudo-random source (splitmix64). The standard distributions are implementation
+// defined, so they are avoided in order for a (size, seed) pair to name the same input everywhere.
+class Random {
+ public:
+  explicit Random(std::uint64_t seed) : state_{seed} {}
+
+  auto next() -> std::uint64_t {
+    std::uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27U)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31U);
+  }
+
+  // Uniform integer in [low, high]
+  template <std::integral Int>
+  auto uniform(Int low, Int high) -> Int {
+    assert(low <= high);
+    const auto span = std::uint64_t(high) - std::uint64_t(low) + 1ULL;
+    if (span == 0ULL) {  // Full 64-bit range
+      return Int(next());
+    }
+    return Int(std::uint64_t(low) + (next() % span));  // The modulo bias is irrelevant here
+  }
+
+  // True with probability `p`
+  auto chance(double p) -> bool { return double(next() >> 11U) * 0x1.0p-53 < p; }
+
+  template <std::ranges::random_access_range Range>
+  auto pick(Range&& range) -> decltype(auto) {
+    const auto size = std::ranges::size(range);
+    assert(size != 0);
+    return std::ranges::begin(range)[std::ptrdiff_t(uniform(0UZ, std::size_t(size) - 1UZ))];
+  }
+
+  template <std::ranges::random_access_range Range>
+  auto shuffle(Range&& range) {
+    auto first = std::ranges::begin(range);
+    for (auto i = std::size_t(std::ranges::size(range)); i > 1UZ; --i) {
+      std::ranges::iter_swap(std::next(first, std::ptrdiff_t(i - 1UZ)),
+                             std::next(first, std::ptrdiff_t(uniform(0UZ, i - 1UZ))));
+    }
+  }
+
+ private:
+  std::uint64_t state_;
+};
+
+// Character grid rendered as newline-terminated rows, the layout of every map-like input
+class TextGrid {
+ public:
+  TextGrid(Idx row_count, Idx col_count, char fill)
+      : col_count_{col_count}, text_(std::size_t(row_count) * std::size_t(col_count + 1), fill) {
+    for (Idx row{}; row != row_count; ++row) {
+      text_[offset(Loc{row, col_count})] = '\n';
+    }
+  }
+
+  auto row_count() const { return Idx(text_.size() / std::size_t(col_count_ + 1)); }
+  auto col_count() const { return col_count_; }
+
+  auto contains(Loc loc) const {
+    return loc.row >= Idx{} && loc.row < row_count() && loc.col >= Idx{} && loc.col < col_count_;
+  }
+
+  auto operator[](Loc loc) const { return text_[offset(loc)]; }
+  auto operator[](Loc loc) -> char& { return text_[offset(loc)]; }
+
+  auto text() && { return std::move(text_); }
+
+ private:
+  auto offset(Loc loc) const -> std::size_t {
+    return (std::size_t(loc.row) * std::size_t(col_count_ + 1)) + std::size_t(loc.col);
+  }
+
+  Idx col_count_;
+  std::string text_;
+};
+
+// Spanning tree of a lattice of cells, grown by a randomized depth-first search whose long winding
+// branches make good mazes. Returns the (cell, parent) edges in discovery order from `root`.
+inline auto random_spanning_tree(Idx row_count, Idx col_count, Loc root, Random& random) {
+  constexpr std::array<Loc, 4> steps{
+      {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+  const auto contains = [&](Loc loc) {
+    return loc.row >= Idx{} && loc.row < row_count && loc.col >= Idx{} && loc.col < col_count;
+  };
+  std::vector<std::uint8_t> visited(std::size_t(row_count) * std::size_t(col_count));
+  const auto visit = [&](Loc loc) -> auto& {
+    return visited[(std::size_t(loc.row) * std::size_t(col_count)) + std::size_t(loc.col)];
+  };
+
+  std::vector<std::pair<Loc, Loc>> result;
+  result.reserve(visited.size());
+  std::vector<Loc> path{root};
+  visit(root) = 1;
+  while (!path.empty()) {
+    const Loc current = path.back();
+    std::array<Loc, 4> candidates{};
+    std::size_t candidate_count{};
+    for (const Loc step : steps) {
+      if (const Loc next = current + step; contains(next) && visit(next) == 0) {
+        candidates[candidate_count++] = next;
+      }
+    }
+    if (candidate_count == 0UZ) {
+      path.pop_back();
+      continue;
+    }
+    const Loc next = candidates[random.uniform(0UZ, candidate_count - 1UZ)];
+    visit(next) = 1;
+    result.emplace_back(next, current);
+    path.push_back(next);
+  }
+  return result;
+}
+
+inline constexpr auto no_size_limit = std::numeric_limits<std::size_t>::max();
+// Largest square grid whose cell count still fits in an Idx
+inline constexpr auto max_grid_side = 46340UZ;
+
+// Synthetic input source for one day. The size is a single knob whose meaning depends on the
+// puzzle (grid side, line count...), and the inputs keep the guarantees the solver relies on.
+struct Generator {
+  using Generate = auto (*)(std::size_t size, Random& random) -> std::string;
+
+  std::string_view day;
+  std::string_view unit;  // What the size counts
+  std::size_t min_size;
+  std::size_t max_size;  // Beyond it the input no longer fits the solver's types
+  Generate generate;
+};
+
+// Every generator linked into the executable, in registration order
+inline auto generators() -> std::vector<Generator>& {
+  static std::vector<Generator> result;
+  return result;
+}
+
+inline auto find_generator(std::string_view day) -> const Generator* {
+  for (const auto& generator : generators()) {
+    if (generator.day == day) {
+      return &generator;
+    }
+  }
+  return nullptr;
+}
+
+inline auto register_generator(const Generator& generator) {
+  generators().push_back(generator);
+  return true;
+}
+
+inline auto generate(const Generator& generator, std::size_t size, std::uint64_t seed) {
+  assert(size >= generator.min_size && size <= generator.max_size);
+  Random random{seed};
+  return generator.generate(size, random);
+}
+
+}  // namespace aoc
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "loc.hpp"
+#include "snapshot.hpp"
+
+namespace aoc {
+
+// Layouts map the positions of a grid, border included, to indices into its cell array, and step
+// from an index to the indices of its neighbours. They are built from the padded dimensions and
+// take positions relative to the top-left border cell.
+
+// Row after row, like the text of the inputs. A step between neighbours is the same index offset
+// everywhere, but a vertical one jumps a whole row.
+class RowMajorLayout {
+ public:
+  // Identifies the layout in snapshots
+  static constexpr Idx tag{0};
+
+  RowMajorLayout(Idx row_count, Idx col_count) : row_count_{row_count}, col_count_{col_count} {}
+
+  auto cell_count() const { return std::size_t(row_count_) * std::size_t(col_count_); }
+  auto index(Loc loc) const {
+    return (std::size_t(loc.row) * std::size_t(col_count_)) + std::size_t(loc.col);
+  }
+  auto position(std::size_t index) const {
+    return Loc{.row = Idx(index / std::size_t(col_count_)),
+               .col = Idx(index % std::size_t(col_count_))};
+  }
+  // Index of the cell `move` away from the one at `index`
+  auto step(std::size_t index, Loc move) const {
+    return std::size_t(std::ptrdiff_t(index) + std::ptrdiff_t((move.row * col_count_) + move.col));
+  }
+
+ private:
+  Idx row_count_;
+  Idx col_count_;
+};
+
+enum class TileOrder : std::uint8_t {
+  row_major,
+  z_order,  // Morton order: the bits of the row and the column interleaved
+};
+
+// Square tiles of 2^tile_bits cells a side, themselves laid out row after row, so that the cells
+// around any one are mostly in the same tile and the same few cache lines and pages. The
+// dimensions are rounded up to whole tiles, the extra cells being part of the border.
+template <unsigned tile_bits, TileOrder order>
+class TiledLayout {
+  static_assert(tile_bits >= 1U && tile_bits <= 15U);
+  static constexpr Idx mask = (Idx{1} << tile_bits) - Idx{1};
+
+ public:
+  static constexpr Idx tag = ((Idx(order) + Idx{1}) << 8U) | Idx(tile_bits);
+
+  TiledLayout(Idx row_count, Idx col_count)
+      : tile_row_count_{(row_count + mask) >> tile_bits},
+        tile_col_count_{(col_count + mask) >> tile_bits} {}
+
+  auto cell_count() const {
+    return (std::size_t(tile_row_count_) * std::size_t(tile_col_count_)) << (2U * tile_bits);
+  }
+
+  auto index(Loc loc) const {
+    const auto tile = (std::size_t(loc.row >> tile_bits) * std::size_t(tile_col_count_)) +
+                      std::size_t(loc.col >> tile_bits);
+    return (tile << (2U * tile_bits)) | within_tile(loc.row & mask, loc.col & mask);
+  }
+
+  auto position(std::size_t index) const {
+    const auto tile = index >> (2U * tile_bits);
+    const auto within = index & cell_mask;
+    Loc result{.row = Idx(tile / std::size_t(tile_col_count_)) << tile_bits,
+               .col = Idx(tile % std::size_t(tile_col_count_)) << tile_bits};
+    if constexpr (order == TileOrder::z_order) {
+      result.row |= Idx(compact_bits(within >> 1U));
+      result.col |= Idx(compact_bits(within));
+    } else {
+      result.row |= Idx(within >> tile_bits);
+      result.col |= Idx(within) & mask;
+    }
+    return result;
+  }
+
+  // Only steps leaving the tile need its position
+  auto step(std::size_t index, Loc move) const {
+    const auto within = index & cell_mask;
+    Loc to = move;
+    if constexpr (order == TileOrder::z_order) {
+      to.row += Idx(compact_bits(within >> 1U));
+      to.col += Idx(compact_bits(within));
+    } else {
+      to.row += Idx(within >> tile_bits);
+      to.col += Idx(within) & mask;
+    }
+    if (((to.row | to.col) & ~mask) == Idx{}) {
+      return (index & ~cell_mask) | within_tile(to.row, to.col);
+    }
+    return this->index(position(index) + move);
+  }
+
+ private:
+  static constexpr auto cell_mask = (std::size_t{1} << (2U * tile_bits)) - 1UZ;
+
+  static auto within_tile(Idx row, Idx col) -> std::size_t {
+    if constexpr (order == TileOrder::z_order) {
+      return (spread_bits(std::uint32_t(row)) << 1U) | spread_bits(std::uint32_t(col));
+    } else {
+      return (std::size_t(row) << tile_bits) | std::size_t(col);
+    }
+  }
+
+  // Moves the low 16 bits of `x` to the even bits of the result, and back
+  static auto spread_bits(std::uint32_t x) -> std::size_t {
+#if defined(__BMI2__)
+    return std::size_t(_pdep_u64(x, 0x55555555ULL));
+#else
+    std::uint64_t result = x & 0xffffU;
+    result = (result | (result << 8U)) & 0x00ff00ffULL;
+    result = (result | (result << 4U)) & 0x0f0f0f0fULL;
+    result = (result | (result << 2U)) & 0x33333333ULL;
+    result = (result | (result << 1U)) & 0x55555555ULL;
+    return std::size_t(result);
+#endif
+  }
+  static auto compact_bits(std::size_t x) -> std::uint32_t {
+#if defined(__BMI2__)
+    return std::uint32_t(_pext_u64(x, 0x55555555ULL));
+#else
+    std::uint64_t result = x & 0x55555555ULL;
+    result = (result | (result >> 1U)) & 0x33333333ULL;
+    result = (result | (result >> 2U)) & 0x0f0f0f0fULL;
+    result = (result | (result >> 4U)) & 0x00ff00ffULL;
+    result = (result | (result >> 8U)) & 0x0000ffffULL;
+    return std::uint32_t(result);
+#endif
+  }
+
+  Idx tile_row_count_;
+  Idx tile_col_count_;
+};
+
+// 64x64 tiles, 4 KiB for byte-sized cells
+using TiledGridLayout = TiledLayout<6U, TileOrder::row_major>;
+using MortonGridLayout = TiledLayout<8U, TileOrder::z_order>;
+
+// The layout of the grids of the solvers, chosen by the AOC_GRID_LAYOUT CMake option
+#if defined(AOC_GRID_LAYOUT_TILED)
+using DefaultGridLayout = TiledGridLayout;
+#elif defined(AOC_GRID_LAYOUT_MORTON)
+using DefaultGridLayout = MortonGridLayout;
+#else
+using DefaultGridLayout = RowMajorLayout;
+#endif
+
+// Dense 2D array surrounded by a border of `padding` cells holding a sentinel value, so that the
+// neighbours of any inner cell can be read without bounds checks. Its cells are stored in the
+// order of `Layout`.
+template <typename T, typename Layout = DefaultGridLayout>
+class Grid {
+  static_assert(!std::is_same_v<T, bool>, "use a byte-sized enum instead of std::vector<bool>");
+
+ public:
+  using Index = std::size_t;
+
+  Grid(Idx row_count, Idx col_count, const T& value, const T& border, Idx padding = Idx{1})
+      : row_count_{row_count},
+        col_count_{col_count},
+        padding_{padding},
+        layout_{row_count + (Idx{2} * padding), col_count + (Idx{2} * padding)},
+        cells_(layout_.cell_count(), border) {
+    assert(row_count_ >= Idx{} && col_count_ >= Idx{} && padding_ >= Idx{});
+    for (Idx row{}; row != row_count_; ++row) {
+      if constexpr (std::is_same_v<Layout, RowMajorLayout>) {
+        const auto first = std::next(cells_.begin(), std::ptrdiff_t(index(Loc{row, Idx{}})));
+        std::fill(first, std::next(first, col_count_), value);
+      } else {
+        for (Idx col{}; col != col_count_; ++col) {
+          cells_[index(Loc{row, col})] = value;
+        }
+      }
+    }
+  }
+
+  auto row_count() const { return row_count_; }
+  auto col_count() const { return col_count_; }
+  auto padding() const { return padding_; }
+  // Number of cells, border included, which bounds the values of index()
+  auto cell_count() const { return cells_.size(); }
+  // Every cell, border included, in index order, which is the order of the layout
+  auto cells() const -> std::span<const T> { return cells_; }
+  auto cells() -> std::span<T> { return cells_; }
+
+  auto contains(Loc loc) const {
+    return loc.row >= Idx{} && loc.row < row_count_ && loc.col >= Idx{} && loc.col < col_count_;
+  }
+
+  auto index(Loc loc) const -> Index {
+    assert(loc.row >= -padding_ && loc.row < row_count_ + padding_);
+    assert(loc.col >= -padding_ && loc.col < col_count_ + padding_);
+    return Index(layout_.index(Loc{.row = loc.row + padding_, .col = loc.col + padding_}));
+  }
+
+  auto loc(Index index) const {
+    const Loc position = layout_.position(index);
+    return Loc{.row = position.row - padding_, .col = position.col - padding_};
+  }
+
+  auto operator[](Loc loc) const -> const T& { return cells_[index(loc)]; }
+  auto operator[](Loc loc) -> T& { return cells_[index(loc)]; }
+  auto operator[](Index index) const -> const T& { return cells_[index]; }
+  auto operator[](Index index) -> T& { return cells_[index]; }
+
+  template <std::size_t n>
+  auto neighbors(Loc loc, const std::array<Loc, n>& moves) const {
+    std::array<Loc, n> result;
+    std::ranges::transform(moves, result.begin(), [loc](const Loc& m) { return loc + m; });
+    return result;
+  }
+
+  template <std::size_t n>
+  auto neighbors(Index index, const std::array<Loc, n>& moves) const {
+    std::array<Index, n> result;
+    std::ranges::transform(moves, result.begin(),
+                           [this, index](const Loc& m) { return Index(layout_.step(index, m)); });
+    return result;
+  }
+
+  // Inner locations in row-major order
+  auto locs() const {
+    return std::views::cartesian_product(std::views::iota(Idx{}, row_count_),
+                                         std::views::iota(Idx{}, col_count_)) |
+           std::views::transform(
+               [](const auto& p) { return Loc{.row = std::get<0>(p), .col = std::get<1>(p)}; });
+  }
+
+  // Inner cells in row-major order
+  auto values() const {
+    return locs() | std::views::transform([this](const Loc& loc) { return (*this)[loc]; });
+  }
+
+ private:
+  Idx row_count_;
+  Idx col_count_;
+  Idx padding_;
+  Layout layout_;
+  std::vector<T> cells_;
+};
+
+// Builds a grid from newline-separated rows of characters, `convert(loc, c)` giving each tile
+template <typename T, typename Layout = DefaultGridLayout, typename Text, typename Convert>
+auto parse_grid(const Text& text, const T& border, Convert convert, Idx padding = Idx{1}) {
+  auto lines = std::views::split(text, '\n') |
+               std::views::filter([](const auto& line) { return !std::ranges::empty(line); });
+  const auto row_count = Idx(std::ranges::distance(lines));
+  const auto col_count =
+      row_count == Idx{} ? Idx{} : Idx(std::ranges::distance(*std::ranges::begin(lines)));
+
+  Grid<T, Layout> result{row_count, col_count, border, border, padding};
+  for (const auto& [row, line] : std::views::enumerate(lines)) {
+    for (const auto& [col, c] : std::views::enumerate(line)) {
+      const Loc loc{.row = Idx(row), .col = Idx(col)};
+      result[loc] = convert(loc, c);
+    }
+  }
+  return result;
+}
+
+// Snapshots hold the dimensions, the layout and every cell, border included, in its order
+template <FlatSnapshot T, typename Layout>
+struct Snapshot<Grid<T, Layout>> {
+  static auto save(SnapshotWriter& writer, const Grid<T, Layout>& grid) {
+    writer.write(std::array{grid.row_count(), grid.col_count(), grid.padding(), Layout::tag});
+    writer.write_size(grid.cell_count());
+    writer.write_array(grid.cells());
+  }
+
+  static auto load(SnapshotReader& reader) -> Grid<T, Layout> {
+    const auto [row_count, col_count, padding, tag] = reader.read<std::array<Idx, 4>>();
+    const auto cells = reader.read_array<T>(reader.read_size());
+    const auto valid =
+        row_count >= Idx{} && col_count >= Idx{} && padding >= Idx{} && tag == Layout::tag &&
+        cells.size() ==
+            Layout{row_count + (Idx{2} * padding), col_count + (Idx{2} * padding)}.cell_count();
+    if (!valid) {
+      reader.fail();
+      return Grid<T, Layout>{Idx{}, Idx{}, T{}, T{}, Idx{}};
+    }
+    Grid<T, Layout> result{row_count, col_count, T{}, T{}, padding};
+    std::ranges::copy(cells, result.cells().begin());
+    return result;
+  }
+};
+
+}  // namespace aoc
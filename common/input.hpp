@@ -0,0 +1,70 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace aoc {
+
+// Read-only memory mapping of a whole input file, handed to the parsers without any copy
+class MappedFile {
+ public:
+  static auto open(const std::filesystem::path& path) -> std::optional<MappedFile> {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return std::nullopt;
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) != 0) {
+      ::close(fd);
+      return std::nullopt;
+    }
+    const auto size = std::size_t(status.st_size);
+    void* address = nullptr;
+    if (size != 0UZ) {
+      address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (address == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+      return std::nullopt;
+    }
+    if (address != nullptr) {
+      ::madvise(address, size, MADV_SEQUENTIAL);
+      ::madvise(address, size, MADV_WILLNEED);
+    }
+    return MappedFile{address, size};
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept
+      : address_{std::exchange(other.address_, nullptr)}, size_{std::exchange(other.size_, 0UZ)} {}
+  auto operator=(const MappedFile&) -> MappedFile& = delete;
+  auto operator=(MappedFile&& other) noexcept -> MappedFile& {
+    std::swap(address_, other.address_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+  ~MappedFile() {
+    if (address_ != nullptr) {
+      ::munmap(address_, size_);
+    }
+  }
+
+  auto text() const { return std::string_view{static_cast<const char*>(address_), size_}; }
+
+ private:
+  MappedFile(void* address, std::size_t size) : address_{address}, size_{size} {}
+
+  void* address_;
+  std::size_t size_;
+};
+
+}  // namespace aoc
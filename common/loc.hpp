@@ -0,0 +1,35 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+namespace aoc {
+
+using Idx = std::int32_t;
+
+struct Loc {
+  Idx row;
+  Idx col;
+
+  auto operator<=>(const Loc& other) const = default;
+};
+
+inline auto operator+(const Loc& left, const Loc& right) {
+  return Loc{.row = left.row + right.row, .col = left.col + right.col};
+}
+
+inline auto operator-(const Loc& left, const Loc& right) {
+  return Loc{.row = left.row - right.row, .col = left.col - right.col};
+}
+
+// Both coordinates in one 64-bit key, the row in the high half, for hashing and for sets and maps
+// of locations stored as plain integers
+constexpr auto pack(Loc loc) -> std::uint64_t {
+  return (std::uint64_t(std::uint32_t(loc.row)) << 32U) | std::uint32_t(loc.col);
+}
+
+constexpr auto unpack(std::uint64_t key) -> Loc {
+  return Loc{.row = Idx(std::uint32_t(key >> 32U)), .col = Idx(std::uint32_t(key))};
+}
+
+}  // namespace aoc
@@ -0,0 +1,83 @@
+#pragma once
+
+// Memory used by the solvers: heap allocations counted by the global operator new replacement of
+// tools/allocation_hook.cpp, when AOC_TRACK_ALLOCATIONS is defined and it is linked in, and the
+// peak resident set size of the process as reported by Linux.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+
+namespace aoc::memory {
+
+#if defined(AOC_TRACK_ALLOCATIONS)
+inline constexpr bool tracking_allocations{true};
+#else
+inline constexpr bool tracking_allocations{false};
+#endif
+
+// Sizes are the usable sizes of the blocks, which include the rounding of the allocator
+struct Allocations {
+  std::uint64_t count;
+  std::uint64_t bytes;
+  std::uint64_t live_bytes;
+  std::uint64_t peak_live_bytes;  // Since the last reset_peak()
+};
+
+namespace detail {
+
+inline std::atomic<std::uint64_t> count;
+inline std::atomic<std::uint64_t> bytes;
+inline std::atomic<std::uint64_t> live_bytes;
+inline std::atomic<std::uint64_t> peak_live_bytes;
+
+}  // namespace detail
+
+inline auto record_allocation(std::size_t size) {
+  detail::count.fetch_add(1U, std::memory_order_relaxed);
+  detail::bytes.fetch_add(size, std::memory_order_relaxed);
+  const auto live = detail::live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  auto peak = detail::peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !detail::peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+inline auto record_deallocation(std::size_t size) {
+  detail::live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+inline auto allocations() -> Allocations {
+  return Allocations{.count = detail::count.load(std::memory_order_relaxed),
+                     .bytes = detail::bytes.load(std::memory_order_relaxed),
+                     .live_bytes = detail::live_bytes.load(std::memory_order_relaxed),
+                     .peak_live_bytes = detail::peak_live_bytes.load(std::memory_order_relaxed)};
+}
+
+inline auto reset_peak() {
+  detail::peak_live_bytes.store(detail::live_bytes.load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+}
+
+// VmHWM of /proc/self/status
+inline auto peak_rss() -> std::optional<std::uint64_t> {
+  std::ifstream in{"/proc/self/status"};
+  for (std::string line; std::getline(in, line);) {
+    if (line.starts_with("VmHWM:")) {
+      return std::stoull(line.substr(6)) * 1024U;  // In kB
+    }
+  }
+  return std::nullopt;
+}
+
+// Lowers the peak RSS to the current RSS (Linux 4.0+), so that it measures what follows
+inline auto reset_peak_rss() {
+  std::ofstream out{"/proc/self/clear_refs"};
+  out << "5";
+  return bool(out.flush());
+}
+
+}  // namespace aoc::memory
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <charconv>
+#include <optional>
+#include <print>
+#include <string_view>
+#include <system_error>
+
+namespace aoc {
+
+// Number given as the value of a command-line option, which must be all of `text`. Nothing, with a
+// message on stderr, if it is not one, or if it is negative for an unsigned type.
+template <typename T>
+auto option_value(std::string_view option, std::string_view text) -> std::optional<T> {
+  T value{};
+  const auto* const last = text.data() + text.size();
+  if (const auto [end, error] = std::from_chars(text.data(), last, value);
+      text.empty() || error != std::errc{} || end != last) {
+    std::println(stderr, "Invalid value for option {}: {}", option, text);
+    return std::nullopt;
+  }
+  return value;
+}
+
+}  // namespace aoc
@@ -0,0 +1,305 @@
+#pragma once
+
+// Data-parallel loops over independent records on a work-stealing scheduler. The range is cut into
+// chunks independently of the number of threads, and reductions combine the chunks in order, so
+// the results are the same whatever the schedule. The calling thread works on its own loop too,
+// which makes nested and concurrent loops safe.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "counters.hpp"
+
+namespace aoc {
+
+namespace detail {
+
+inline auto thread_count() -> std::atomic<std::size_t>& {
+  static std::atomic<std::size_t> result{[] {
+    if (const char* value = std::getenv("AOC_THREADS"); value != nullptr && *value != '\0') {
+      return std::max(std::size_t(std::strtoull(value, nullptr, 10)), 1UZ);
+    }
+    return std::size_t(std::max(std::thread::hardware_concurrency(), 1U));
+  }()};
+  return result;
+}
+
+inline auto thread_cpu_seconds() {
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return double(ts.tv_sec) + (double(ts.tv_nsec) * 1e-9);
+}
+
+inline auto assisted_cpu() -> double& {
+  thread_local double result{};
+  return result;
+}
+
+}  // namespace detail
+
+// Threads of the parallel loops, the calling one included: $AOC_THREADS, else one per core
+inline auto parallel_thread_count() -> std::size_t {
+  return detail::thread_count().load(std::memory_order_relaxed);
+}
+
+// Overrides parallel_thread_count from now on. With 1, the loops stay on the calling thread, for
+// the measurements that only see that thread, such as the perf_event counters.
+inline auto set_parallel_thread_count(std::size_t count) {
+  detail::thread_count().store(std::max(count, 1UZ), std::memory_order_relaxed);
+}
+
+// CPU seconds that the other threads spent so far in the parallel loops of the calling thread,
+// which its own CPU time misses
+inline auto assisted_cpu_seconds() { return detail::assisted_cpu(); }
+
+namespace detail {
+
+// Chunks of a loop left to one of its threads, as [begin, end) packed in one word, so that the
+// owner taking chunks from the front and thieves splitting off the back half agree through a CAS
+class ChunkRange {
+ public:
+  auto assign(std::uint32_t begin, std::uint32_t end) {
+    bounds_.store(pack(begin, end), std::memory_order_release);
+  }
+
+  auto take() -> std::optional<std::uint32_t> {
+    auto bounds = bounds_.load(std::memory_order_acquire);
+    for (;;) {
+      const auto [begin, end] = unpack(bounds);
+      if (begin == end) {
+        return std::nullopt;
+      }
+      if (bounds_.compare_exchange_weak(bounds, pack(begin + 1U, end),
+                                        std::memory_order_acq_rel)) {
+        return begin;
+      }
+    }
+  }
+
+  auto steal() -> std::optional<std::pair<std::uint32_t, std::uint32_t>> {
+    auto bounds = bounds_.load(std::memory_order_acquire);
+    for (;;) {
+      const auto [begin, end] = unpack(bounds);
+      if (begin == end) {
+        return std::nullopt;
+      }
+      const auto middle = begin + ((end - begin) / 2U);
+      if (bounds_.compare_exchange_weak(bounds, pack(begin, middle), std::memory_order_acq_rel)) {
+        return std::pair{middle, end};
+      }
+    }
+  }
+
+ private:
+  static constexpr auto pack(std::uint32_t begin, std::uint32_t end) -> std::uint64_t {
+    return (std::uint64_t{begin} << 32U) | end;
+  }
+  static constexpr auto unpack(std::uint64_t bounds) -> std::pair<std::uint32_t, std::uint32_t> {
+    return std::pair{std::uint32_t(bounds >> 32U), std::uint32_t(bounds)};
+  }
+
+  std::atomic<std::uint64_t> bounds_;
+};
+
+// One parallel loop: the chunks are dealt evenly to the slots, one per thread joining the loop,
+// and a thread whose slot is empty steals half of another one. Slots whose thread never joins
+// are stolen like the others.
+struct Loop {
+  Loop(std::size_t chunk_count, std::size_t slot_count, void (*run)(const void*, std::size_t),
+       const void* body)
+      : run{run}, body{body}, slots(slot_count) {
+    for (std::size_t slot{}; slot != slot_count; ++slot) {
+      slots[slot].assign(std::uint32_t(chunk_count * slot / slot_count),
+                         std::uint32_t(chunk_count * (slot + 1UZ) / slot_count));
+    }
+  }
+
+  auto participate(std::size_t slot) {
+    auto& own = slots[slot];
+    for (;;) {
+      while (const auto chunk = own.take()) {
+        run(body, *chunk);
+      }
+      auto stolen = false;
+      for (std::size_t i{1}; i != slots.size() && !stolen; ++i) {
+        if (const auto range = slots[(slot + i) % slots.size()].steal()) {
+          own.assign(range->first, range->second);
+          stolen = true;
+        }
+      }
+      if (!stolen) {
+        return;
+      }
+    }
+  }
+
+  void (*run)(const void*, std::size_t);
+  const void* body;
+  std::vector<ChunkRange> slots;
+  std::size_t joined{1};  // Slots handed out, the first one to the calling thread
+  std::size_t active{1};  // Threads still in the loop
+  double assisted_cpu{};   // Of the threads that joined
+#if defined(AOC_ENABLE_COUNTERS)
+  std::string phase{counters::current().phase};
+#endif
+};
+
+class Scheduler {
+ public:
+  explicit Scheduler(std::size_t worker_count) {
+    workers_.reserve(worker_count);
+    for (std::size_t i{}; i != worker_count; ++i) {
+      workers_.emplace_back([this](const std::stop_token& stop) { work(stop); });
+    }
+  }
+
+  Scheduler(const Scheduler&) = delete;
+  Scheduler(Scheduler&&) = delete;
+  auto operator=(const Scheduler&) -> Scheduler& = delete;
+  auto operator=(Scheduler&&) -> Scheduler& = delete;
+
+  ~Scheduler() {
+    for (auto& worker : workers_) {
+      worker.request_stop();
+    }
+    ready_.notify_all();
+  }
+
+  // Calls run_chunk(chunk) for every chunk in [0, chunk_count), returning once all are done
+  template <typename RunChunk>
+  auto run(std::size_t chunk_count, const RunChunk& run_chunk) {
+    Loop loop{chunk_count, workers_.size() + 1UZ,
+              [](const void* body, std::size_t chunk) {
+                (*static_cast<const RunChunk*>(body))(chunk);
+              },
+              &run_chunk};
+    {
+      const std::scoped_lock lock{mutex_};
+      loops_.push_back(&loop);
+    }
+    ready_.notify_all();
+    loop.participate(0UZ);
+
+    std::unique_lock lock{mutex_};
+    std::erase(loops_, &loop);
+    --loop.active;
+    done_.wait(lock, [&loop] { return loop.active == 0UZ; });
+    assisted_cpu() += loop.assisted_cpu;
+  }
+
+ private:
+  auto joinable() const {
+    return std::ranges::find_if(loops_, [](const Loop* loop) {
+      return loop->joined != loop->slots.size();
+    });
+  }
+
+  auto work(const std::stop_token& stop) -> void {
+    for (;;) {
+      Loop* loop{};
+      std::size_t slot{};
+      {
+        std::unique_lock lock{mutex_};
+        ready_.wait(lock, stop, [this] { return joinable() != loops_.end(); });
+        const auto it = joinable();
+        if (it == loops_.end()) {
+          return;
+        }
+        loop = *it;
+        slot = loop->joined++;
+        ++loop->active;
+      }
+      // Including the loops that this one started and other threads helped with
+      const auto cpu_start = thread_cpu_seconds() + assisted_cpu();
+      {
+#if defined(AOC_ENABLE_COUNTERS)
+        const counters::Assist assist{loop->phase};
+#endif
+        loop->participate(slot);
+      }
+      const auto cpu = thread_cpu_seconds() + assisted_cpu() - cpu_start;
+      auto finished = false;
+      {
+        const std::scoped_lock lock{mutex_};
+        loop->assisted_cpu += cpu;
+        finished = --loop->active == 0UZ;
+      }
+      if (finished) {
+        done_.notify_all();
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable_any ready_;
+  std::condition_variable done_;
+  std::vector<Loop*> loops_;
+  std::vector<std::jthread> workers_;
+};
+
+inline auto scheduler() -> Scheduler& {
+  static Scheduler result{parallel_thread_count() - 1UZ};
+  return result;
+}
+
+// At most this many chunks per loop, so that they stay cheap to schedule
+inline constexpr std::size_t max_chunk_count{256};
+
+inline auto chunk_size(std::size_t count, std::size_t grain) {
+  return std::max({grain, 1UZ, (count + max_chunk_count - 1UZ) / max_chunk_count});
+}
+
+}  // namespace detail
+
+// Calls body(begin, end) on consecutive chunks covering [0, count), of `grain` indices at least
+template <typename Body>
+auto parallel_for(std::size_t count, std::size_t grain, const Body& body) {
+  const auto size = detail::chunk_size(count, grain);
+  const auto chunk_count = (count + size - 1UZ) / size;
+  const auto run_chunk = [&](std::size_t chunk) {
+    body(chunk * size, std::min(count, (chunk + 1UZ) * size));
+  };
+  if (chunk_count <= 1UZ || parallel_thread_count() == 1UZ) {
+    for (std::size_t chunk{}; chunk != chunk_count; ++chunk) {
+      run_chunk(chunk);
+    }
+    return;
+  }
+  detail::scheduler().run(chunk_count, run_chunk);
+}
+
+// Folds map(x) for every x of `range` with `reduce`: each chunk from `identity`, then the results
+// of the chunks in order
+template <std::ranges::random_access_range Range, typename T, typename Map,
+          typename Reduce = std::plus<>>
+auto parallel_reduce(Range&& range, std::size_t grain, T identity, Map map, Reduce reduce = {})
+    -> T {
+  const auto count = std::size_t(std::ranges::size(range));
+  const auto first = std::ranges::begin(range);
+  const auto size = detail::chunk_size(count, grain);
+  std::vector<T> partials((count + size - 1UZ) / size, identity);
+  parallel_for(count, grain, [&](std::size_t begin, std::size_t end) {
+    auto result = identity;
+    for (auto i = begin; i != end; ++i) {
+      result = reduce(std::move(result), map(first[std::ptrdiff_t(i)]));
+    }
+    partials[begin / size] = std::move(result);
+  });
+  return std::ranges::fold_left(partials, std::move(identity), reduce);
+}
+
+}  // namespace aoc
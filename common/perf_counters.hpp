@@ -0,0 +1,150 @@
+#pragma once
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace aoc {
+
+enum class PerfEvent : std::uint8_t {
+  cycles,
+  instructions,
+  cache_references,
+  cache_misses,
+  branches,
+  branch_misses,
+  page_faults,
+};
+
+inline constexpr std::array perf_events{
+    PerfEvent::cycles,
+    PerfEvent::instructions,
+    PerfEvent::cache_references,
+    PerfEvent::cache_misses,
+    PerfEvent::branches,
+    PerfEvent::branch_misses,
+    PerfEvent::page_faults,
+};
+
+// Event counts, or nothing for the events that could not be counted
+struct PerfSample {
+  std::array<std::optional<double>, perf_events.size()> counts;
+
+  auto operator[](PerfEvent event) const { return counts[std::to_underlying(event)]; }
+
+  auto ratio(PerfEvent numerator, PerfEvent denominator) const -> std::optional<double> {
+    const auto top = (*this)[numerator];
+    const auto bottom = (*this)[denominator];
+    if (!top.has_value() || !bottom.has_value() || *bottom == 0.0) {
+      return std::nullopt;
+    }
+    return *top / *bottom;
+  }
+
+  auto ipc() const { return ratio(PerfEvent::instructions, PerfEvent::cycles); }
+  auto cache_miss_rate() const {
+    return ratio(PerfEvent::cache_misses, PerfEvent::cache_references);
+  }
+  auto branch_miss_rate() const { return ratio(PerfEvent::branch_misses, PerfEvent::branches); }
+};
+
+// Hardware and software counters of the calling thread, in user space, read with perf_event_open.
+// Every event is opened on its own, so that the kernel multiplexes them when there are fewer
+// hardware counters than events, and the counts are scaled by the fraction of time each one was
+// running. The events the kernel refuses (no PMU in a VM or container, perf_event_paranoid...)
+// stay closed and read as nothing, which leaves the callers with timings alone.
+class PerfCounters {
+ public:
+  PerfCounters() {
+    for (const PerfEvent event : perf_events) {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      std::tie(attr.type, attr.config) = kernel_event(event);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+      fds_[std::to_underlying(event)] = int(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters(PerfCounters&&) = delete;
+  auto operator=(const PerfCounters&) -> PerfCounters& = delete;
+  auto operator=(PerfCounters&&) -> PerfCounters& = delete;
+  ~PerfCounters() {
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  auto available() const {
+    return std::ranges::any_of(fds_, [](const int fd) { return fd >= 0; });
+  }
+
+  auto start() -> void {
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg)
+        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        // NOLINTEND(cppcoreguidelines-pro-type-vararg)
+      }
+    }
+  }
+
+  auto stop() -> PerfSample {
+    PerfSample result;
+    for (const PerfEvent event : perf_events) {
+      const int fd = fds_[std::to_underlying(event)];
+      if (fd < 0) {
+        continue;
+      }
+      ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+      std::array<std::uint64_t, 3> values{};  // Count, time enabled, time running
+      if (::read(fd, values.data(), sizeof(values)) != ssize_t(sizeof(values)) || values[2] == 0U) {
+        continue;
+      }
+      result.counts[std::to_underlying(event)] =
+          double(values[0]) * double(values[1]) / double(values[2]);
+    }
+    return result;
+  }
+
+ private:
+  static auto kernel_event(PerfEvent event) -> std::pair<std::uint32_t, std::uint64_t> {
+    switch (event) {
+      case PerfEvent::cycles:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+      case PerfEvent::instructions:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+      case PerfEvent::cache_references:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES};
+      case PerfEvent::cache_misses:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+      case PerfEvent::branches:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS};
+      case PerfEvent::branch_misses:
+        return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+      case PerfEvent::page_faults:
+        return {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS};
+    }
+    std::unreachable();
+  }
+
+  std::array<int, perf_events.size()> fds_{};
+};
+
+}  // namespace aoc
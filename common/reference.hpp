@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+
+namespace aoc {
+
+// Straightforward solver of a day, kept as the oracle of the optimized one registered with
+// register_day. aoc_diff runs both on the real input and on generated inputs of sizes up to
+// `max_generated_size`, beyond which the reference takes too long.
+struct Reference {
+  std::unique_ptr<const Day> solver;
+  std::size_t max_generated_size;
+};
+
+// Every reference linked into the executable, in registration order
+inline auto references() -> std::vector<Reference>& {
+  static std::vector<Reference> result;
+  return result;
+}
+
+template <typename Parse, typename Part1, typename Part2 = std::nullptr_t>
+auto register_reference(std::string_view name, std::size_t max_generated_size, Parse parse,
+                         Part1 part1, Part2 part2 = nullptr) {
+  references().push_back(
+      Reference{.solver = std::make_unique<const Solution<Parse, std::nullptr_t, Part1, Part2>>(
+                    name, std::move(parse), nullptr, std::move(part1), std::move(part2)),
+                .max_generated_size = max_generated_size});
+  return true;
+}
+
+}  // namespace aoc
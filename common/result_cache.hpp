@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "build_identity.hpp"
+#include "flat_hash.hpp"
+
+namespace aoc {
+
+struct Answers {
+  std::string part1;
+  std::optional<std::string> part2;
+};
+
+// Answers stored on disk, one file per day, input and solver version, so that solving the same
+// input again with the same code is a file read. Entries are never rewritten in place, so a stale
+// one is simply never looked up again.
+class ResultCache {
+ public:
+  // Under $AOC_CACHE_DIR, else $XDG_CACHE_HOME/aoc2024 or ~/.cache/aoc2024
+  static auto open() -> std::optional<ResultCache> {
+    std::filesystem::path directory;
+    if (const char* dir = std::getenv("AOC_CACHE_DIR"); dir != nullptr && *dir != '\0') {
+      directory = dir;
+    } else if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg != nullptr && *xdg != '\0') {
+      directory = std::filesystem::path{xdg} / "aoc2024";
+    } else if (const char* home = std::getenv("HOME"); home != nullptr && *home != '\0') {
+      directory = std::filesystem::path{home} / ".cache" / "aoc2024";
+    } else {
+      return std::nullopt;
+    }
+    const auto version = build_identity();
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (!version.has_value() || error) {
+      return std::nullopt;
+    }
+    return ResultCache{std::move(directory), *version};
+  }
+
+  ResultCache(std::filesystem::path directory, std::uint64_t version)
+      : directory_{std::move(directory)}, version_{version} {}
+
+  auto lookup(std::string_view day, std::string_view text) const -> std::optional<Answers> {
+    std::ifstream in{entry_path(day, text)};
+    std::string tag;
+    Answers result;
+    if (!std::getline(in, tag) || tag != format_tag || !std::getline(in, result.part1)) {
+      return std::nullopt;
+    }
+    if (std::string part2; std::getline(in, part2)) {
+      result.part2 = std::move(part2);
+    }
+    return result;
+  }
+
+  // Written to a temporary file first, so that concurrent readers never see a partial entry
+  auto store(std::string_view day, std::string_view text, const Answers& answers) const -> bool {
+    assert(!answers.part1.contains('\n') && !answers.part2.value_or("").contains('\n'));
+    const auto path = entry_path(day, text);
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+      std::ofstream out{temporary, std::ios::trunc};
+      out << format_tag << '\n' << answers.part1 << '\n';
+      if (answers.part2.has_value()) {
+        out << *answers.part2 << '\n';
+      }
+      if (!out) {
+        return false;
+      }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+  }
+
+ private:
+  static constexpr std::string_view format_tag{"aoc-result-cache 1"};
+
+  auto entry_path(std::string_view day, std::string_view text) const -> std::filesystem::path {
+    return directory_ / std::format("{}-{:016x}-{:016x}", day, Hash{}(text), version_);
+  }
+
+  std::filesystem::path directory_;
+  std::uint64_t version_;
+};
+
+}  // namespace aoc
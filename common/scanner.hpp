@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <bit>
+#endif
+
+namespace aoc {
+
+// Position of the first decimal digit (or minus sign, when `with_sign` is set) in `text` at or
+// after `pos`, or `text.size()` when there is none. Whole blocks are classified with AVX2 or
+// SSE4.2 when the target supports them, the tail byte by byte, as is everything at compile time.
+constexpr auto find_number(std::string_view text, std::size_t pos, bool with_sign)
+    -> std::size_t {
+  const char* const data = text.data();
+  const std::size_t size = text.size();
+  if !consteval {
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i minus = _mm256_set1_epi8('-');
+    for (; pos + 32UZ <= size; pos += 32UZ) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+      const __m256i offset = _mm256_sub_epi8(chunk, zero);
+      __m256i hits = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, nine), offset);
+      if (with_sign) {
+        hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(chunk, minus));
+      }
+      if (const auto mask = std::uint32_t(_mm256_movemask_epi8(hits)); mask != 0U) {
+        return pos + std::size_t(std::countr_zero(mask));
+      }
+    }
+#elif defined(__SSE4_2__)
+    constexpr int mode = _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_LEAST_SIGNIFICANT;
+    const __m128i ranges = _mm_setr_epi8('0', '9', '-', '-', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const int range_bytes = with_sign ? 4 : 2;
+    for (; pos + 16UZ <= size; pos += 16UZ) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+      if (const int i = _mm_cmpestri(ranges, range_bytes, chunk, 16, mode); i != 16) {
+        return pos + std::size_t(i);
+      }
+    }
+#endif
+  }
+  for (; pos != size; ++pos) {
+    const char c = data[pos];
+    if ((c >= '0' && c <= '9') || (with_sign && c == '-')) {
+      return pos;
+    }
+  }
+  return size;
+}
+
+// Forward-only tokenizer over a whole input, yielding lines and integers as views into the text.
+// Usable in constant expressions, for the inputs embedded with AOC_EMBED_INPUTS.
+class Scanner {
+ public:
+  constexpr explicit Scanner(std::string_view text) : text_{text} {}
+
+  constexpr auto done() const { return pos_ == text_.size(); }
+
+  // Next line without its terminator; the final line needs no trailing newline
+  constexpr auto line() -> std::string_view {
+    assert(!done());
+    // string_view::find goes through memchr, which is already vectorized
+    const auto end = std::min(text_.find('\n', pos_), text_.size());
+    const auto result = text_.substr(pos_, end - pos_);
+    pos_ = std::min(end + 1UZ, text_.size());
+    return result;
+  }
+
+  // Next integer in the text, skipping whatever separates it from the current position. A minus
+  // sign directly before the digits is only honoured for signed types.
+  template <std::integral Int>
+  constexpr auto next() -> std::optional<Int> {
+    const char* const data = text_.data();
+    const char* const last = std::next(data, std::ptrdiff_t(text_.size()));
+    while (true) {
+      pos_ = find_number(text_, pos_, std::is_signed_v<Int>);
+      if (done()) {
+        return std::nullopt;
+      }
+      Int result{};
+      const auto [end, status] = from_chars(std::next(data, std::ptrdiff_t(pos_)), last, result);
+      assert(status != std::errc::result_out_of_range);
+      if (status == std::errc{}) {
+        pos_ = std::size_t(end - data);
+        return result;
+      }
+      ++pos_;  // Minus sign not followed by a digit
+    }
+  }
+
+ private:
+  // std::from_chars, digit by digit at compile time where the library's one is not constexpr
+  template <std::integral Int>
+  static constexpr auto from_chars(const char* first, const char* last, Int& value)
+      -> std::from_chars_result {
+    if !consteval {
+      return std::from_chars(first, last, value);
+    }
+    const bool negative = std::is_signed_v<Int> && first != last && *first == '-';
+    const char* it = negative ? std::next(first) : first;
+    if (it == last || *it < '0' || *it > '9') {
+      return {.ptr = first, .ec = std::errc::invalid_argument};
+    }
+    Int result{};
+    for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+      const auto digit = Int(*it - '0');
+      result = Int((result * Int{10}) + (negative ? Int(-digit) : digit));
+    }
+    value = result;
+    return {.ptr = it, .ec = std::errc{}};
+  }
+
+  std::string_view text_;
+  std::size_t pos_{};
+};
+
+}  // namespace aoc
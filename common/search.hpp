@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "counters.hpp"
+
+namespace aoc {
+
+// What a search remembers of how each state was reached
+enum class Predecessors : std::uint8_t {
+  none,
+  one,  // Enough to rebuild a shortest path
+  all,  // Every shortest path, at the price of settling all the goals tied with the first one
+};
+
+// Shortest-path searches over states mapped onto [0, state_count) by `StateIndex`, with costs,
+// predecessors and visited marks in dense arrays. The transitions of a state are produced by
+// `successors(state, emit)`, which calls `emit(next_state, step_cost)` for each of them, so that
+// no container is built per expansion. A search stops once a state satisfying `is_goal` leaves
+// the queue and returns its cost, goals themselves are not expanded.
+template <typename State, typename Cost, typename StateIndex>
+class Search {
+ public:
+  Search(std::size_t state_count, StateIndex index, Predecessors predecessors)
+      : index_{std::move(index)},
+        predecessors_{predecessors},
+        costs_(state_count, unreached),
+        predecessor_(predecessors == Predecessors::one ? state_count : 0UZ),
+        first_link_(predecessors == Predecessors::all ? state_count : 0UZ, no_link) {}
+
+  // Breadth-first search, for steps that all cost one
+  template <typename Successors, typename IsGoal>
+  auto bfs(const State& start, Successors successors, IsGoal is_goal) -> std::optional<Cost> {
+    const auto unit_successors = [&successors](const State& state, auto&& emit) {
+      successors(state, [&emit](const State& next, Cost step_cost) {
+        assert(step_cost == Cost{1});
+        emit(next, step_cost);
+      });
+    };
+    FifoQueue queue;
+    return run(queue, start, unit_successors, no_heuristic, is_goal);
+  }
+
+  // Dijkstra's algorithm on Dial's circular bucket queue, for small integer step costs
+  template <typename Successors, typename IsGoal>
+  auto dial(const State& start, Cost max_step_cost, Successors successors, IsGoal is_goal)
+      -> std::optional<Cost> {
+    BucketQueue queue{std::size_t(max_step_cost) + 1UZ};
+    return run(queue, start, successors, no_heuristic, is_goal);
+  }
+
+  // Dijkstra's algorithm on a binary heap
+  template <typename Successors, typename IsGoal>
+  auto dijkstra(const State& start, Successors successors, IsGoal is_goal)
+      -> std::optional<Cost> {
+    HeapQueue queue;
+    return run(queue, start, successors, no_heuristic, is_goal);
+  }
+
+  // A* on a binary heap, `heuristic(state)` being a consistent lower bound of the cost to a goal
+  template <typename Successors, typename Heuristic, typename IsGoal>
+  auto astar(const State& start, Successors successors, Heuristic heuristic, IsGoal is_goal)
+      -> std::optional<Cost> {
+    HeapQueue queue;
+    return run(queue, start, successors, heuristic, is_goal);
+  }
+
+  // Lowest cost to `state` found by the last search, if it was reached
+  auto cost(const State& state) const -> std::optional<Cost> {
+    const auto result = costs_[index_(state)];
+    return result == unreached ? std::nullopt : std::optional{result};
+  }
+
+  // Goals reached at the lowest cost: the first one, or all of them with Predecessors::all
+  auto goals() const -> std::span<const State> { return goals_; }
+
+  // States of a shortest path from the start to `goal`, both included
+  auto path(const State& goal) const {
+    assert(predecessors_ == Predecessors::one && cost(goal).has_value());
+    std::vector<State> result{goal};
+    while (index_(result.back()) != index_(start_)) {
+      result.push_back(predecessor_[index_(result.back())]);
+    }
+    std::ranges::reverse(result);
+    return result;
+  }
+
+  // Every state lying on a shortest path to one of the goals, each once
+  auto shortest_path_states() const {
+    assert(predecessors_ == Predecessors::all);
+    std::vector<std::uint8_t> seen(costs_.size());
+    std::vector<State> result{goals_.begin(), goals_.end()};
+    for (const auto& goal : goals_) {
+      seen[index_(goal)] = 1;
+    }
+    for (std::size_t i{}; i != result.size(); ++i) {
+      for (auto link = first_link_[index_(result[i])]; link != no_link;
+           link = links_[link].next) {
+        if (auto& mark = seen[index_(links_[link].state)]; mark == 0) {
+          mark = 1;
+          result.push_back(links_[link].state);
+        }
+      }
+    }
+    return result;
+  }
+
+ private:
+  static constexpr auto unreached = std::numeric_limits<Cost>::max();
+  static constexpr auto no_link = std::numeric_limits<std::uint32_t>::max();
+  static constexpr auto no_heuristic = [](const State& /*state*/) { return Cost{}; };
+
+  struct Entry {
+    Cost key;  // Cost, plus the heuristic for A*
+    Cost cost;
+    State state;
+  };
+
+  // Keys are pushed in non-decreasing order, as breadth-first search does
+  class FifoQueue {
+   public:
+    auto empty() const { return head_ == entries_.size(); }
+    auto push(const Entry& entry) { entries_.push_back(entry); }
+    auto pop() { return entries_[head_++]; }
+
+   private:
+    std::vector<Entry> entries_;
+    std::size_t head_{};
+  };
+
+  // Keys pushed lie within the bucket count of the last key popped
+  class BucketQueue {
+   public:
+    explicit BucketQueue(std::size_t bucket_count) : buckets_(bucket_count) {}
+
+    auto empty() const { return size_ == 0UZ; }
+    auto push(const Entry& entry) {
+      buckets_[std::size_t(entry.key) % buckets_.size()].push_back(entry);
+      ++size_;
+    }
+    auto pop() {
+      while (buckets_[current_].empty()) {
+        current_ = (current_ + 1UZ) % buckets_.size();
+      }
+      const auto result = buckets_[current_].back();
+      buckets_[current_].pop_back();
+      --size_;
+      return result;
+    }
+
+   private:
+    std::vector<std::vector<Entry>> buckets_;
+    std::size_t current_{};
+    std::size_t size_{};
+  };
+
+  class HeapQueue {
+   public:
+    auto empty() const { return entries_.empty(); }
+    auto push(const Entry& entry) {
+      entries_.push_back(entry);
+      std::ranges::push_heap(entries_, std::greater<>{}, &Entry::key);
+    }
+    auto pop() {
+      std::ranges::pop_heap(entries_, std::greater<>{}, &Entry::key);
+      const auto result = entries_.back();
+      entries_.pop_back();
+      return result;
+    }
+
+   private:
+    std::vector<Entry> entries_;
+  };
+
+  struct Link {
+    State state;
+    std::uint32_t next;
+  };
+
+  auto reset(const State& start) {
+    std::ranges::fill(costs_, unreached);
+    std::ranges::fill(first_link_, no_link);
+    links_.clear();
+    goals_.clear();
+    start_ = start;
+  }
+
+  template <typename Queue, typename Successors, typename Heuristic, typename IsGoal>
+  auto run(Queue& queue, const State& start, Successors& successors, const Heuristic& heuristic,
+           IsGoal& is_goal) -> std::optional<Cost> {
+    reset(start);
+    costs_[index_(start)] = Cost{};
+    queue.push(Entry{.key = heuristic(start), .cost = Cost{}, .state = start});
+
+    std::optional<Cost> result;
+    while (!queue.empty()) {
+      const auto entry = queue.pop();
+      AOC_COUNT("queue pops", 1);
+      if (result.has_value() && entry.key > *result) {
+        break;  // Every goal tied with the first one was reached
+      }
+      if (entry.cost != costs_[index_(entry.state)]) {
+        AOC_COUNT("stale entries", 1);  // Pushed again since, with a lower cost
+        continue;
+      }
+      if (is_goal(entry.state)) {
+        result = entry.cost;
+        goals_.push_back(entry.state);
+        if (predecessors_ != Predecessors::all) {
+          break;
+        }
+        continue;
+      }
+      successors(entry.state, [&](const State& next, Cost step_cost) {
+        const auto cost = entry.cost + step_cost;
+        const auto i = index_(next);
+        if (cost < costs_[i]) {
+          costs_[i] = cost;
+          if (predecessors_ == Predecessors::one) {
+            predecessor_[i] = entry.state;
+          } else if (predecessors_ == Predecessors::all) {
+            first_link_[i] = no_link;
+            add_link(i, entry.state);
+          }
+          queue.push(Entry{.key = cost + heuristic(next), .cost = cost, .state = next});
+          AOC_COUNT("queue pushes", 1);
+        } else if (cost == costs_[i] && predecessors_ == Predecessors::all) {
+          add_link(i, entry.state);
+        }
+      });
+    }
+    return result;
+  }
+
+  auto add_link(std::size_t i, const State& predecessor) {
+    links_.push_back(Link{.state = predecessor, .next = first_link_[i]});
+    first_link_[i] = std::uint32_t(links_.size() - 1UZ);
+  }
+
+  StateIndex index_;
+  Predecessors predecessors_;
+  State start_{};
+  std::vector<Cost> costs_;
+  std::vector<State> predecessor_;         // With Predecessors::one
+  std::vector<std::uint32_t> first_link_;  // With Predecessors::all, heads of lists in links_
+  std::vector<Link> links_;
+  std::vector<State> goals_;
+};
+
+template <typename State, typename Cost, typename StateIndex>
+auto make_search(std::size_t state_count, StateIndex index,
+                 Predecessors predecessors = Predecessors::none) {
+  return Search<State, Cost, StateIndex>{state_count, std::move(index), predecessors};
+}
+
+}  // namespace aoc
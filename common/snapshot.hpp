@@ -0,0 +1,315 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "build_identity.hpp"
+#include "flat_hash.hpp"
+
+namespace aoc {
+
+// Compact binary image of a parsed input. Values are stored in host byte order, so snapshots are
+// only used on little-endian hosts, and every array starts at an offset aligned for its elements
+// so that it can be read in place from a mapped file.
+class SnapshotWriter {
+ public:
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  auto write_array(std::span<const T> values) {
+    align(alignof(T));
+    const auto bytes = std::as_bytes(values);
+    bytes_.insert(bytes_.end(), bytes.begin(), bytes.end());
+  }
+
+  template <typename T>
+  auto write(const T& value) {
+    write_array(std::span<const T>{&value, 1UZ});
+  }
+
+  auto write_size(std::size_t size) { write(std::uint64_t(size)); }
+
+  auto bytes() const -> std::span<const std::byte> { return bytes_; }
+
+ private:
+  auto align(std::size_t alignment) -> void {
+    bytes_.resize((bytes_.size() + alignment - 1UZ) / alignment * alignment);
+  }
+
+  std::vector<std::byte> bytes_;
+};
+
+// Reads back what a SnapshotWriter wrote, from a buffer aligned at least like std::max_align_t.
+// Reading past the end makes the reader fail, after which every read yields zeros.
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(std::span<const std::byte> bytes) : bytes_{bytes} {}
+
+  auto ok() const { return ok_; }
+  auto at_end() const { return offset_ == bytes_.size(); }
+  auto fail() -> void { ok_ = false; }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  auto read_array(std::size_t size) -> std::span<const T> {
+    offset_ = (offset_ + alignof(T) - 1UZ) / alignof(T) * alignof(T);
+    if (!ok_ || offset_ > bytes_.size() || size > (bytes_.size() - offset_) / sizeof(T)) {
+      fail();
+      return {};
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* first = reinterpret_cast<const T*>(bytes_.data() + offset_);
+    offset_ += size * sizeof(T);
+    return {first, size};
+  }
+
+  template <typename T>
+  auto read() -> T {
+    const auto values = read_array<T>(1UZ);
+    return values.empty() ? T{} : values.front();
+  }
+
+  // Element count of a sequence, which cannot exceed the bytes left for its elements
+  auto read_size() -> std::size_t {
+    const auto size = std::size_t(read<std::uint64_t>());
+    if (size > bytes_.size() - offset_) {
+      fail();
+      return {};
+    }
+    return size;
+  }
+
+ private:
+  std::span<const std::byte> bytes_;
+  std::size_t offset_{};
+  bool ok_{true};
+};
+
+// How a type is written to and read from snapshots. Trivially copyable types are copied as they
+// are, so they must not hold pointers; standard containers of supported types are supported, and
+// so are aggregates listing their members in order with `snapshot_fields`, found by ADL:
+//
+//   auto snapshot_fields(const Input& input) { return std::tie(input.maze, input.start); }
+//
+// Other types can specialize the template.
+template <typename T>
+struct Snapshot;
+
+template <typename T>
+concept Snapshottable = requires(SnapshotWriter& writer, SnapshotReader& reader, const T& value) {
+  Snapshot<T>::save(writer, value);
+  { Snapshot<T>::load(reader) } -> std::same_as<T>;
+};
+
+template <typename T>
+concept FlatSnapshot = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> &&
+                       !std::is_member_pointer_v<T> && std::is_default_constructible_v<T>;
+
+template <typename T>
+concept HasSnapshotFields = requires(const T& value) { snapshot_fields(value); };
+
+template <FlatSnapshot T>
+struct Snapshot<T> {
+  static auto save(SnapshotWriter& writer, const T& value) { writer.write(value); }
+  static auto load(SnapshotReader& reader) -> T { return reader.read<T>(); }
+};
+
+template <>
+struct Snapshot<std::string> {
+  static auto save(SnapshotWriter& writer, const std::string& value) {
+    writer.write_size(value.size());
+    writer.write_array(std::span{value});
+  }
+  static auto load(SnapshotReader& reader) -> std::string {
+    const auto chars = reader.read_array<char>(reader.read_size());
+    return {chars.begin(), chars.end()};
+  }
+};
+
+template <Snapshottable T>
+struct Snapshot<std::vector<T>> {
+  static auto save(SnapshotWriter& writer, const std::vector<T>& values) {
+    writer.write_size(values.size());
+    if constexpr (FlatSnapshot<T>) {
+      writer.write_array(std::span{values});
+    } else {
+      for (const T& value : values) {
+        Snapshot<T>::save(writer, value);
+      }
+    }
+  }
+  static auto load(SnapshotReader& reader) -> std::vector<T> {
+    const auto size = reader.read_size();
+    if constexpr (FlatSnapshot<T>) {
+      const auto values = reader.read_array<T>(size);
+      return {values.begin(), values.end()};
+    } else {
+      std::vector<T> result;
+      result.reserve(size);
+      for (std::size_t i{}; i != size && reader.ok(); ++i) {
+        result.push_back(Snapshot<T>::load(reader));
+      }
+      return result;
+    }
+  }
+};
+
+template <Snapshottable T, std::size_t n>
+  requires(!FlatSnapshot<std::array<T, n>>)
+struct Snapshot<std::array<T, n>> {
+  static auto save(SnapshotWriter& writer, const std::array<T, n>& values) {
+    for (const T& value : values) {
+      Snapshot<T>::save(writer, value);
+    }
+  }
+  static auto load(SnapshotReader& reader) -> std::array<T, n> {
+    // Braced initializers are evaluated in order
+    return [&reader]<std::size_t... i>(std::index_sequence<i...>) {
+      return std::array<T, n>{(void(i), Snapshot<T>::load(reader))...};
+    }(std::make_index_sequence<n>{});
+  }
+};
+
+template <Snapshottable First, Snapshottable Second>
+  requires(!FlatSnapshot<std::pair<First, Second>>)
+struct Snapshot<std::pair<First, Second>> {
+  static auto save(SnapshotWriter& writer, const std::pair<First, Second>& value) {
+    Snapshot<First>::save(writer, value.first);
+    Snapshot<Second>::save(writer, value.second);
+  }
+  static auto load(SnapshotReader& reader) -> std::pair<First, Second> {
+    return {Snapshot<First>::load(reader), Snapshot<Second>::load(reader)};
+  }
+};
+
+template <typename T>
+  requires(!FlatSnapshot<T> && HasSnapshotFields<T>)
+struct Snapshot<T> {
+  static auto save(SnapshotWriter& writer, const T& value) {
+    std::apply(
+        [&writer](const auto&... fields) {
+          (Snapshot<std::remove_cvref_t<decltype(fields)>>::save(writer, fields), ...);
+        },
+        snapshot_fields(value));
+  }
+  static auto load(SnapshotReader& reader) -> T {
+    using Fields = decltype(snapshot_fields(std::declval<const T&>()));
+    return [&reader]<typename... Field>(std::type_identity<std::tuple<Field...>>) {
+      return T{Snapshot<std::remove_cvref_t<Field>>::load(reader)...};
+    }(std::type_identity<Fields>{});
+  }
+};
+
+// Identity of the text a snapshot was made from: rewriting the text makes the snapshot stale
+struct SnapshotSource {
+  std::uint64_t size;
+  std::int64_t modified;
+
+  static auto of(const std::filesystem::path& path) -> std::optional<SnapshotSource> {
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    if (error) {
+      return std::nullopt;
+    }
+    const auto modified = std::filesystem::last_write_time(path, error);
+    if (error) {
+      return std::nullopt;
+    }
+    return SnapshotSource{.size = size, .modified = modified.time_since_epoch().count()};
+  }
+
+  auto operator==(const SnapshotSource&) const -> bool = default;
+};
+
+struct SnapshotHeader {
+  static constexpr std::array<char, 8> expected_magic{'A', 'O', 'C', 'S', 'N', 'A', 'P', '\0'};
+  static constexpr std::uint32_t current_version{3};
+  static constexpr std::uint32_t expected_byte_order{0x01020304};
+
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  SnapshotSource source;
+  std::uint64_t build;  // As a rebuild may change what the parser makes of the same text
+  std::uint64_t payload_size;
+  std::uint64_t checksum;  // Of the payload, as decoding trusts the values it copies
+
+  static auto checksum_of(std::span<const std::byte> payload) -> std::uint64_t {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return Hash{}(std::string_view{reinterpret_cast<const char*>(payload.data()), payload.size()});
+  }
+};
+
+// The payload follows the header at the first offset aligned for any type
+inline constexpr auto snapshot_payload_offset =
+    (sizeof(SnapshotHeader) + alignof(std::max_align_t) - 1UZ) / alignof(std::max_align_t) *
+    alignof(std::max_align_t);
+
+// Payload of a snapshot file made from `source` by the running build, or nothing if it is stale
+// or damaged
+inline auto snapshot_payload(std::span<const std::byte> file, const SnapshotSource& source)
+    -> std::optional<std::span<const std::byte>> {
+  const auto build = build_identity();
+  if (!build.has_value() || file.size() < snapshot_payload_offset) {
+    return std::nullopt;
+  }
+  SnapshotHeader header{};
+  std::memcpy(&header, file.data(), sizeof(header));
+  const auto payload = file.subspan(snapshot_payload_offset);
+  if (header.magic != SnapshotHeader::expected_magic ||
+      header.version != SnapshotHeader::current_version ||
+      header.byte_order != SnapshotHeader::expected_byte_order || header.source != source ||
+      header.build != *build || header.payload_size != payload.size() ||
+      header.checksum != SnapshotHeader::checksum_of(payload)) {
+    return std::nullopt;
+  }
+  return payload;
+}
+
+// Written to a temporary file first, so that readers never see a partial snapshot
+inline auto write_snapshot_file(const std::filesystem::path& path, const SnapshotSource& source,
+                                std::span<const std::byte> payload) -> bool {
+  const auto build = build_identity();
+  if (!build.has_value()) {
+    return false;
+  }
+  const SnapshotHeader header{.magic = SnapshotHeader::expected_magic,
+                              .version = SnapshotHeader::current_version,
+                              .byte_order = SnapshotHeader::expected_byte_order,
+                              .source = source,
+                              .build = *build,
+                              .payload_size = payload.size(),
+                              .checksum = SnapshotHeader::checksum_of(payload)};
+  auto temporary = path;
+  temporary += ".tmp";
+  {
+    std::ofstream out{temporary, std::ios::binary | std::ios::trunc};
+    std::array<char, snapshot_payload_offset> prefix{};
+    std::memcpy(prefix.data(), &header, sizeof(header));
+    out.write(prefix.data(), std::streamsize(prefix.size()));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    out.write(reinterpret_cast<const char*>(payload.data()), std::streamsize(payload.size()));
+    if (!out) {
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary, path, error);
+  return !error;
+}
+
+}  // namespace aoc
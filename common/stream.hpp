@@ -0,0 +1,366 @@
+#pragma once
+
+// Streaming mode of the line-oriented days, for inputs too large to map and parse at once. A
+// reader thread reads the file in fixed-size chunks, a parser thread cuts them into lines, the
+// line cut at the end of a chunk being carried over to the next one, and makes a batch of records
+// of each chunk, which the calling thread hands to the solver as they arrive. Bounded queues
+// between the stages hold the reader back when the solver lags, so that only a few chunks are in
+// memory at any time.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "counters.hpp"
+#include "result_cache.hpp"
+#include "scanner.hpp"
+#include "trace.hpp"
+
+namespace aoc {
+
+struct StreamOptions {
+  std::size_t chunk_size{std::size_t{1} << 20U};
+  std::size_t queue_capacity{4};  // Chunks, or batches of records, waiting between two stages
+};
+
+namespace detail {
+
+// Calls `action` when leaving the scope, by returning or by throwing
+template <typename Action>
+class ScopeExit {
+ public:
+  explicit ScopeExit(Action action) : action_{std::move(action)} {}
+  ScopeExit(const ScopeExit&) = delete;
+  ScopeExit(ScopeExit&&) = delete;
+  auto operator=(const ScopeExit&) -> ScopeExit& = delete;
+  auto operator=(ScopeExit&&) -> ScopeExit& = delete;
+  ~ScopeExit() { action_(); }
+
+ private:
+  Action action_;
+};
+
+}  // namespace detail
+
+// Queue between two threads, whose producer waits while it holds `capacity` items
+template <typename T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(std::size_t capacity) : capacity_{std::max(capacity, 1UZ)} {}
+
+  // False, dropping the item, if the queue is closed: its consumer has left
+  auto push(T item) {
+    {
+      std::unique_lock lock{mutex_};
+      not_full_.wait(lock, [this] { return items_.size() < capacity_ || closed_; });
+      if (closed_) {
+        return false;
+      }
+      items_.push(std::move(item));
+    }
+    not_empty_.notify_one();
+    return true;
+  }
+
+  // No more pushes: pop returns nothing once the queue is drained, and push returns at once
+  auto close() {
+    {
+      const std::scoped_lock lock{mutex_};
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  auto pop() -> std::optional<T> {
+    std::optional<T> result;
+    {
+      std::unique_lock lock{mutex_};
+      not_empty_.wait(lock, [this] { return !items_.empty() || closed_; });
+      if (items_.empty()) {
+        return std::nullopt;
+      }
+      result = std::move(items_.front());
+      items_.pop();
+    }
+    not_full_.notify_one();
+    return result;
+  }
+
+ private:
+  std::size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  std::queue<T> items_;
+  bool closed_{};
+};
+
+// Calls consume(batch) on the records that parse_line(line) makes of the lines of the file at
+// `path`, in file order, a batch per chunk. The lines for which parse_line returns nothing are
+// skipped. False if the file cannot be read. An exception thrown by parse_line or consume stops
+// every stage and is rethrown.
+template <typename ParseLine, typename Consume>
+auto stream_records(const std::filesystem::path& path, const StreamOptions& options,
+                    const ParseLine& parse_line, const Consume& consume) -> bool {
+  using Record = std::invoke_result_t<const ParseLine&, std::string_view>::value_type;
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  const detail::ScopeExit close_file{[fd] { ::close(fd); }};
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  BoundedQueue<std::string> chunks{options.queue_capacity};
+  BoundedQueue<std::vector<Record>> batches{options.queue_capacity};
+  // Each stage closes the queues it uses when it leaves, whichever way, so that the stages on
+  // either side never wait for it forever
+  const auto closing = [](auto&... queues) {
+    return detail::ScopeExit{[&queues...] { (queues.close(), ...); }};
+  };
+  std::exception_ptr reader_error;
+  std::exception_ptr parser_error;
+  auto failed = false;
+  {
+    const std::jthread reader{[&] {
+      try {
+        const auto guard = closing(chunks);
+        for (auto full = true; full;) {
+          const trace::Span span{"read", "stream"};
+          std::string chunk(std::max(options.chunk_size, 1UZ), '\0');
+          std::size_t size{};
+          while (size != chunk.size()) {
+            const auto count = ::read(fd, std::next(chunk.data(), std::ptrdiff_t(size)),
+                                      chunk.size() - size);
+            if (count < 0 && errno == EINTR) {
+              continue;
+            }
+            if (count <= 0) {
+              failed = count < 0;
+              break;
+            }
+            size += std::size_t(count);
+          }
+          full = size == chunk.size();
+          chunk.resize(size);
+          if (!chunk.empty() && !chunks.push(std::move(chunk))) {
+            return;
+          }
+        }
+      } catch (...) {
+        reader_error = std::current_exception();
+      }
+    }};
+
+    const std::jthread parser{[&] {
+      try {
+        const auto guard = closing(chunks, batches);
+        const auto parse = [&](std::string_view text, std::vector<Record>& batch) {
+          Scanner lines{text};
+          while (!lines.done()) {
+            if (auto record = parse_line(lines.line()); record.has_value()) {
+              batch.push_back(std::move(*record));
+            }
+          }
+        };
+        std::string carry;  // Start of the line cut at the end of the previous chunks
+        while (const auto chunk = chunks.pop()) {
+          const trace::Span span{"tokenize", "stream"};
+          std::string_view text{*chunk};
+          const auto last = text.rfind('\n');
+          if (last == std::string_view::npos) {
+            carry += text;
+            continue;
+          }
+          std::vector<Record> batch;
+          if (!carry.empty()) {
+            const auto first = text.find('\n');
+            carry += text.substr(0UZ, first);
+            parse(carry, batch);
+            text.remove_prefix(first + 1UZ);
+          }
+          const auto complete = text.size() - (chunk->size() - last - 1UZ);
+          parse(text.substr(0UZ, complete), batch);
+          carry.assign(text.substr(complete));
+          if (!batch.empty() && !batches.push(std::move(batch))) {
+            return;
+          }
+        }
+        if (!carry.empty()) {
+          std::vector<Record> batch;
+          parse(carry, batch);
+          batches.push(std::move(batch));
+        }
+      } catch (...) {
+        parser_error = std::current_exception();
+      }
+    }};
+
+    const auto guard = closing(chunks, batches);
+    while (const auto batch = batches.pop()) {
+      consume(std::span<const Record>{*batch});
+    }
+  }
+  for (const auto& error : {reader_error, parser_error}) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return !failed;
+}
+
+// Type-erased solver of a day taking its input as a stream, next to the one registered with
+// register_day, for the drivers' --stream mode
+class StreamingDay {
+ public:
+  explicit StreamingDay(std::string_view name) : name_{name} {}
+  StreamingDay(const StreamingDay&) = delete;
+  StreamingDay(StreamingDay&&) = delete;
+  auto operator=(const StreamingDay&) -> StreamingDay& = delete;
+  auto operator=(StreamingDay&&) -> StreamingDay& = delete;
+  virtual ~StreamingDay() = default;
+
+  auto name() const { return name_; }
+
+  // Answers for the input at `path`, or nothing if it cannot be read
+  virtual auto solve(const std::filesystem::path& path, const StreamOptions& options) const
+      -> std::optional<Answers> = 0;
+
+ private:
+  std::string_view name_;
+};
+
+// The records of each batch are folded into a State, starting from `initial`, with
+// consume(state, batch); the parts then take the final state, as the parts of a Solution take
+// the input
+template <typename ParseLine, typename State, typename Consume, typename Analyze, typename Part1,
+          typename Part2>
+class StreamingSolution final : public StreamingDay {
+ public:
+  StreamingSolution(std::string_view name, ParseLine parse_line, State initial, Consume consume,
+                    Analyze analyze, Part1 part1, Part2 part2)
+      : StreamingDay{name},
+        parse_line_{std::move(parse_line)},
+        initial_{std::move(initial)},
+        consume_{std::move(consume)},
+        analyze_{std::move(analyze)},
+        part1_{std::move(part1)},
+        part2_{std::move(part2)} {}
+
+  auto solve(const std::filesystem::path& path, const StreamOptions& options) const
+      -> std::optional<Answers> override {
+    auto state = initial_;
+    {
+      const counters::Phase phase{name(), "stream"};
+      const trace::Span span{"stream", name()};
+      const auto consume = [&](const auto& batch) { consume_(state, batch); };
+      if (!stream_records(path, options, parse_line_, consume)) {
+        return std::nullopt;
+      }
+    }
+
+    const auto analysis = analyze(state);
+    Answers result;
+    {
+      const counters::Phase phase{name(), "part1"};
+      const trace::Span span{"part1", name()};
+      result.part1 = std::format("{}", solve(part1_, state, analysis));
+    }
+    if constexpr (!std::is_null_pointer_v<Part2>) {
+      const counters::Phase phase{name(), "part2"};
+      const trace::Span span{"part2", name()};
+      result.part2 = std::format("{}", solve(part2_, state, analysis));
+    }
+    return result;
+  }
+
+ private:
+  auto analyze(const State& state) const {
+    if constexpr (std::is_null_pointer_v<Analyze>) {
+      return nullptr;
+    } else {
+      const counters::Phase phase{name(), "analysis"};
+      const trace::Span span{"analysis", name()};
+      return analyze_(state);
+    }
+  }
+
+  auto solve(const auto& part, const State& state, const auto& analysis) const {
+    if constexpr (std::is_null_pointer_v<Analyze>) {
+      return part(state);
+    } else {
+      return part(state, analysis);
+    }
+  }
+
+  ParseLine parse_line_;
+  State initial_;
+  Consume consume_;
+  Analyze analyze_;
+  Part1 part1_;
+  Part2 part2_;
+};
+
+// Every streaming solver linked into the executable, in registration order
+inline auto streaming_registry() -> std::vector<std::unique_ptr<const StreamingDay>>& {
+  static std::vector<std::unique_ptr<const StreamingDay>> days;
+  return days;
+}
+
+inline auto find_streaming_day(std::string_view name) -> const StreamingDay* {
+  for (const auto& day : streaming_registry()) {
+    if (day->name() == name) {
+      return day.get();
+    }
+  }
+  return nullptr;
+}
+
+template <typename ParseLine, typename State, typename Consume, typename Part1,
+          typename Part2 = std::nullptr_t>
+auto register_streaming_day(std::string_view name, ParseLine parse_line, State initial,
+                            Consume consume, Part1 part1, Part2 part2 = nullptr) {
+  streaming_registry().push_back(
+      std::make_unique<
+          const StreamingSolution<ParseLine, State, Consume, std::nullptr_t, Part1, Part2>>(
+          name, std::move(parse_line), std::move(initial), std::move(consume), nullptr,
+          std::move(part1), std::move(part2)));
+  return true;
+}
+
+// For days whose parts share work: both take the final state and what `analyze(state)` returned
+template <typename ParseLine, typename State, typename Consume, typename Analyze, typename Part1,
+          typename Part2 = std::nullptr_t>
+auto register_streaming_analyzed_day(std::string_view name, ParseLine parse_line, State initial,
+                                     Consume consume, Analyze analyze, Part1 part1,
+                                     Part2 part2 = nullptr) {
+  streaming_registry().push_back(
+      std::make_unique<const StreamingSolution<ParseLine, State, Consume, Analyze, Part1, Part2>>(
+          name, std::move(parse_line), std::move(initial), std::move(consume), std::move(analyze),
+          std::move(part1), std::move(part2)));
+  return true;
+}
+
+}  // namespace aoc
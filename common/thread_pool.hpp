@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Fixed-size pool of worker threads; pending tasks are drained before destruction completes
+class ThreadPool {
+ public:
+  explicit ThreadPool(std::size_t thread_count) {
+    workers_.reserve(thread_count);
+    for (std::size_t i{}; i != thread_count; ++i) {
+      workers_.emplace_back([this](const std::stop_token& stop) { work(stop); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+  ~ThreadPool() {
+    for (auto& worker : workers_) {
+      worker.request_stop();
+    }
+    ready_.notify_all();
+  }
+
+  auto thread_count() const { return workers_.size(); }
+
+  auto submit(std::function<void()> task) {
+    {
+      const std::scoped_lock lock{mutex_};
+      tasks_.push(std::move(task));
+    }
+    ready_.notify_one();
+  }
+
+ private:
+  auto work(const std::stop_token& stop) -> void {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock{mutex_};
+        ready_.wait(lock, stop, [this] { return !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable_any ready_;
+  std::queue<std::function<void()>> tasks_;
+  std::vector<std::jthread> workers_;
+};
+
+}  // namespace aoc
@@ -0,0 +1,152 @@
+#pragma once
+
+// Timeline of the solver phases and hot functions, written as a Chrome trace (chrome://tracing or
+// ui.perfetto.dev). Tracing is off until start() is called; until then a span costs one relaxed
+// atomic load. Spans are recorded per thread without locking, so write() must only be called once
+// the traced threads are done.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc::trace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Event {
+  std::string_view name;
+  std::string_view category;
+  Clock::time_point start;
+  Clock::duration duration;
+};
+
+struct ThreadEvents {
+  std::uint32_t thread_id;
+  std::vector<Event> events;
+};
+
+class Recorder {
+ public:
+  auto enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  auto start() {
+    origin_ = Clock::now();
+    enabled_.store(true, std::memory_order_relaxed);
+  }
+
+  auto attach() -> ThreadEvents* {
+    const std::scoped_lock lock{mutex_};
+    return threads_
+        .emplace_back(std::make_unique<ThreadEvents>(
+            ThreadEvents{.thread_id = next_thread_id_++, .events = {}}))
+        .get();
+  }
+
+  auto detach(ThreadEvents* thread) {
+    const std::scoped_lock lock{mutex_};
+    const auto it = std::ranges::find(threads_, thread, &std::unique_ptr<ThreadEvents>::get);
+    if (it != threads_.end() && (*it)->events.empty()) {
+      threads_.erase(it);  // Otherwise kept for write()
+    }
+  }
+
+  auto write(const std::filesystem::path& path) -> bool {
+    const std::scoped_lock lock{mutex_};
+    std::ofstream out{path};
+    const auto microseconds = [](Clock::duration duration) {
+      return std::chrono::duration<double, std::micro>{duration}.count();
+    };
+    std::print(out, "{{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+    auto first = true;
+    for (const auto& thread : threads_) {
+      for (const Event& event : thread->events) {
+        std::print(out,
+                   "{}\n{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"ts\": {:.3f}, "
+                   "\"dur\": {:.3f}, \"pid\": 1, \"tid\": {}}}",
+                   first ? "" : ",", event.name, event.category,
+                   microseconds(event.start - origin_), microseconds(event.duration),
+                   thread->thread_id);
+        first = false;
+      }
+    }
+    std::print(out, "\n]}}\n");
+    return bool(out);
+  }
+
+ private:
+  std::atomic<bool> enabled_{};
+  Clock::time_point origin_;
+  std::mutex mutex_;
+  std::uint32_t next_thread_id_{1};
+  std::vector<std::unique_ptr<ThreadEvents>> threads_;
+};
+
+inline auto recorder() -> Recorder& {
+  static Recorder result;
+  return result;
+}
+
+// Events of the calling thread, handed to the recorder when the thread ends
+class ThreadBuffer {
+ public:
+  ThreadBuffer() : events_{recorder().attach()} {}
+  ThreadBuffer(const ThreadBuffer&) = delete;
+  ThreadBuffer(ThreadBuffer&&) = delete;
+  auto operator=(const ThreadBuffer&) -> ThreadBuffer& = delete;
+  auto operator=(ThreadBuffer&&) -> ThreadBuffer& = delete;
+  ~ThreadBuffer() { recorder().detach(events_); }
+
+  auto push(const Event& event) { events_->events.push_back(event); }
+
+ private:
+  ThreadEvents* events_;
+};
+
+inline auto thread_buffer() -> ThreadBuffer& {
+  thread_local ThreadBuffer result;
+  return result;
+}
+
+inline auto start() { recorder().start(); }
+
+inline auto write(const std::filesystem::path& path) { return recorder().write(path); }
+
+// Records the time between its construction and its destruction. Both names must outlive the
+// trace, e.g. string literals or day names.
+class Span {
+ public:
+  explicit Span(std::string_view name, std::string_view category = "aoc")
+      : name_{name}, category_{category} {
+    if (recorder().enabled()) {
+      start_ = Clock::now();
+    }
+  }
+  Span(const Span&) = delete;
+  Span(Span&&) = delete;
+  auto operator=(const Span&) -> Span& = delete;
+  auto operator=(Span&&) -> Span& = delete;
+  ~Span() {
+    if (start_ != Clock::time_point{}) {
+      thread_buffer().push(Event{.name = name_,
+                                 .category = category_,
+                                 .start = start_,
+                                 .duration = Clock::now() - start_});
+    }
+  }
+
+ private:
+  std::string_view name_;
+  std::string_view category_;
+  Clock::time_point start_;
+};
+
+}  // namespace aoc::trace
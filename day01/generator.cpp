@@ -0,0 +1,40 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day01 {
+
+using Int = std::int64_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::vector<Int> left(size);
+  for (auto& id : left) {
+    id = random.uniform(Int{10000}, Int{99999});
+  }
+
+  std::string result;
+  for (const auto id : left) {
+    // Part #2 only scores the ids present in both lists
+    const auto other =
+        random.chance(0.3) ? random.pick(left) : random.uniform(Int{10000}, Int{99999});
+    std::format_to(std::back_inserter(result), "{}   {}\n", id, other);
+  }
+  return result;
+}
+
+}  // namespace day01
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day01",
+                                                 .unit = "lines",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day01::generate});
+
+}  // namespace
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#include "day.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day01 {
+
+using Int = std::int64_t;
+
+constexpr auto parse_input(std::string_view data) {
+  std::array<std::vector<Int>, 2> result;
+  aoc::Scanner scanner{data};
+  while (const auto left = scanner.next<Int>()) {
+    result[0].push_back(*left);
+    result[1].push_back(*scanner.next<Int>());
+  }
+  return result;
+}
+
+// Pair of locations on one line, for the streaming mode
+auto parse_line(std::string_view line) -> std::optional<std::array<Int, 2>> {
+  aoc::Scanner scanner{line};
+  const auto left = scanner.next<Int>();
+  if (!left.has_value()) {
+    return std::nullopt;
+  }
+  return std::array{*left, *scanner.next<Int>()};
+}
+
+auto solve_part1(const auto& input) {
+  auto data = input;
+  for (auto& list : data) {
+    std::ranges::sort(list);
+  }
+  return std::ranges::fold_left(std::ranges::views::zip(data[0], data[1]), Int{},
+                                [](const auto acc, const auto& elem) {
+                                  return acc + std::abs(std::get<0>(elem) - std::get<1>(elem));
+                                });
+}
+
+auto solve_part2(const auto& input) {
+  const auto& left = input[0];
+  auto right = input[1];
+  std::ranges::sort(right);
+  return std::ranges::fold_left(left, Int{}, [&right](const auto acc, const auto& elem) {
+    return acc + (elem * std::distance(std::ranges::lower_bound(right, elem),
+                                       std::ranges::upper_bound(right, elem)));
+  });
+}
+
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_left = aoc::freeze<[] { return parse_input(aoc::embedded::text)[0]; }>();
+constexpr auto embedded_right = aoc::freeze<[] { return parse_input(aoc::embedded::text)[1]; }>();
+#endif
+
+}  // namespace day01
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day01", [](std::string_view text) { return day01::parse_input(text); },
+    [](const auto& input) { return day01::solve_part1(input); },
+    [](const auto& input) { return day01::solve_part2(input); });
+
+// Both parts sort a whole list, so the lists are gathered as the pairs arrive
+const auto registered_streaming = aoc::register_streaming_day(
+    "day01", [](std::string_view line) { return day01::parse_line(line); },
+    std::array<std::vector<day01::Int>, 2>{},
+    [](auto& lists, const auto& pairs) {
+      for (const auto& [left, right] : pairs) {
+        lists[0].push_back(left);
+        lists[1].push_back(right);
+      }
+    },
+    [](const auto& lists) { return day01::solve_part1(lists); },
+    [](const auto& lists) { return day01::solve_part2(lists); });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse("day01", [] {
+  return std::any{std::array{aoc::thaw(day01::embedded_left), aoc::thaw(day01::embedded_right)}};
+});
+#endif
+
+}  // namespace
@@ -0,0 +1,48 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day02 {
+
+using Int = std::int64_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::string result;
+  std::vector<Int> report;
+  for (std::size_t i{}; i != size; ++i) {
+    // Start from a safe report, then break about half of them with a single bad level
+    const auto level_count = random.uniform(5UZ, 8UZ);
+    const Int direction = random.chance(0.5) ? 1 : -1;
+    report.assign(1UZ, random.uniform(Int{30}, Int{70}));
+    while (report.size() != level_count) {
+      report.push_back(report.back() + (direction * random.uniform(Int{1}, Int{3})));
+    }
+    if (random.chance(0.5)) {
+      random.pick(report) += random.uniform(Int{-6}, Int{6});
+    }
+
+    for (const auto [j, level] : std::views::enumerate(report)) {
+      std::format_to(std::back_inserter(result), "{}{}", j == 0 ? "" : " ", level);
+    }
+    result.push_back('\n');
+  }
+  return result;
+}
+
+}  // namespace day02
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day02",
+                                                 .unit = "reports",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day02::generate});
+
+}  // namespace
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "parallel.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+
+namespace day02 {
+
+using Int = std::int64_t;
+
+// Levels of one report, nothing for a blank line
+auto parse_line(std::string_view line) -> std::optional<std::vector<Int>> {
+  std::vector<Int> result;
+  aoc::Scanner levels{line};
+  while (const auto level = levels.next<Int>()) {
+    result.push_back(*level);
+  }
+  if (result.empty()) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+auto parse_input(std::string_view data) {
+  std::vector<std::vector<Int>> result;
+  aoc::Scanner lines{data};
+  while (!lines.done()) {
+    if (auto report = parse_line(lines.line()); report.has_value()) {
+      result.push_back(std::move(*report));
+    }
+  }
+  return result;
+}
+
+auto is_safe(auto&& report) {
+  auto deltas = std::ranges::views::pairwise_transform(report, std::minus<>{});
+  const auto head = *deltas.cbegin();
+  return std::ranges::all_of(deltas, [&](const auto& value) {
+    return std::abs(value) <= 3 && std::abs(value) >= 1 &&
+           std::signbit(value) == std::signbit(head);
+  });
+}
+
+// Reports checked per task
+constexpr auto grain = 256UZ;
+
+auto solve_part1(const auto& input) {
+  return aoc::parallel_reduce(input, grain, 0UZ, [](const auto& report) {
+    return is_safe(report) ? 1UZ : 0UZ;
+  });
+}
+
+auto solve_part2(const auto& input) {
+  return aoc::parallel_reduce(input, grain, 0UZ, [](const auto& report) {
+    const auto safe =
+        is_safe(report) ||
+        std::ranges::any_of(std::ranges::views::iota(0UZ, report.size()), [&](const auto idx) {
+          return is_safe(
+              std::ranges::views::enumerate(report) |
+              std::ranges::views::filter(
+                  [&](const auto& p) { return std::cmp_not_equal(std::get<0>(p), idx); }) |
+              std::ranges::views::transform([](const auto& p) { return std::get<1>(p); }));
+        });
+    return safe ? 1UZ : 0UZ;
+  });
+}
+
+}  // namespace day02
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day02", [](std::string_view text) { return day02::parse_input(text); },
+    [](const auto& input) { return day02::solve_part1(input); },
+    [](const auto& input) { return day02::solve_part2(input); });
+
+// The reports are independent, so each batch is counted and dropped as it arrives
+const auto registered_streaming = aoc::register_streaming_day(
+    "day02", [](std::string_view line) { return day02::parse_line(line); },
+    std::array<std::size_t, 2>{},
+    [](auto& counts, const auto& reports) {
+      counts[0] += day02::solve_part1(reports);
+      counts[1] += day02::solve_part2(reports);
+    },
+    [](const auto& counts) { return counts[0]; }, [](const auto& counts) { return counts[1]; });
+
+}  // namespace
@@ -0,0 +1,56 @@
+#include <array>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "generator.hpp"
+
+namespace day03 {
+
+using namespace std::string_view_literals;
+
+// Near misses of the instruction syntax, which the solver must skip
+constexpr std::array decoys{"mul[3,7]"sv, "mul(4*"sv,   "mul ( 2 , 4 )"sv, "mul(6,9!"sv,
+                            "?(12,34)"sv, "don't"sv,    "do("sv,           "mul(1234,5)"sv,
+                            "from()"sv,   "select()"sv, "what()"sv,        "how()"sv};
+
+constexpr std::string_view noise = "%&*+-/:;<>?@[]^_{}'!#$()~ ,wherywhatfromselectmuldon";
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::string result;
+  std::size_t line_length{};
+  for (std::size_t i{}; i != size; ++i) {
+    for (auto n = random.uniform(0UZ, 12UZ); n != 0UZ; --n) {
+      result.push_back(random.pick(noise));
+    }
+    if (random.chance(0.3)) {
+      result.append(random.pick(decoys));
+    }
+    if (random.chance(0.1)) {
+      result.append(random.chance(0.5) ? "do()"sv : "don't()"sv);
+    }
+    std::format_to(std::back_inserter(result), "mul({},{})", random.uniform(1, 999),
+                   random.uniform(1, 999));
+
+    if (const auto length = result.size() - line_length; length > 3000UZ) {
+      result.push_back('\n');
+      line_length = result.size();
+    }
+  }
+  result.push_back('\n');
+  return result;
+}
+
+}  // namespace day03
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day03",
+                                                 .unit = "mul instructions",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day03::generate});
+
+}  // namespace
@@ -2,8 +2,6 @@
 #include <charconv>
 #include <cstdint>
 #include <iterator>
-#include <fstream>
-#include <print>
 #include <ranges>
 #include <regex>
 #include <string>
@@ -12,6 +10,10 @@
 #include <variant>
 #include <vector>
 
+#include "day.hpp"
+
+namespace day03 {
+
 using std::operator""sv;
 
 using Int = std::int64_t;
@@ -25,10 +27,9 @@ struct Mul {
 
 using Cmd = std::variant<Mul, bool>;
 
-auto parse_input(std::istream&& in) {
+auto parse_input(std::string_view data) {
   std::vector<Cmd> result;
 
-  std::string data(std::istreambuf_iterator<char>{in}, {});
   const std::regex re(R"(mul\([0-9]{1,3},[0-9]{1,3}\)|do\(\)|don't\(\))");
   std::regex_iterator it{data.cbegin(), data.cend(), re};
 
@@ -84,10 +85,13 @@ auto solve_part2(const auto& input) {
       .first;
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day03
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day03", [](std::string_view text) { return day03::parse_input(text); },
+    [](const auto& input) { return day03::solve_part1(input); },
+    [](const auto& input) { return day03::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,35 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day04 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  constexpr std::string_view alphabet = "XMAS";
+  const auto side = Idx(size);
+  aoc::TextGrid result{side, side, '.'};
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      result[Loc{row, col}] = random.pick(alphabet);
+    }
+  }
+  return std::move(result).text();
+}
+
+}  // namespace day04
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day04",
+                                                 .unit = "grid side",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day04::generate});
+
+}  // namespace
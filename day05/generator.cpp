@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day05 {
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // Pages are two-digit numbers, ranked by a hidden total order that the rules spell out in full
+  std::array<int, 90> pages{};
+  std::iota(pages.begin(), pages.end(), 10);
+  random.shuffle(pages);
+  constexpr auto page_count = 49UZ;
+  const auto ranked = std::span{pages}.first(page_count);
+
+  std::vector<std::pair<int, int>> rules;
+  for (auto i = 0UZ; i != page_count; ++i) {
+    for (auto j = i + 1UZ; j != page_count; ++j) {
+      rules.emplace_back(ranked[i], ranked[j]);
+    }
+  }
+  random.shuffle(rules);
+
+  std::string result;
+  for (const auto& [before, after] : rules) {
+    std::format_to(std::back_inserter(result), "{}|{}\n", before, after);
+  }
+  result.push_back('\n');
+
+  std::vector<std::size_t> ranks(page_count);
+  for (std::size_t i{}; i != size; ++i) {
+    std::iota(ranks.begin(), ranks.end(), 0UZ);
+    random.shuffle(ranks);
+    ranks.resize((2UZ * random.uniform(2UZ, 11UZ)) + 1UZ);
+    if (random.chance(0.5)) {
+      std::ranges::sort(ranks);
+    }
+    for (const auto [j, rank] : std::views::enumerate(ranks)) {
+      std::format_to(std::back_inserter(result), "{}{}", j == 0 ? "" : ",", ranked[rank]);
+    }
+    result.push_back('\n');
+    ranks.resize(page_count);
+  }
+  return result;
+}
+
+}  // namespace day05
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day05",
+                                                 .unit = "updates",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day05::generate});
+
+}  // namespace
@@ -2,17 +2,20 @@
 #include <cassert>
 #include <charconv>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iterator>
 #include <map>
-#include <print>
 #include <ranges>
 #include <set>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+
+namespace day05 {
+
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
@@ -27,8 +30,7 @@ struct Rule {
 
 using Update = std::vector<Page>;
 
-auto parse_input(std::istream&& in) -> std::pair<std::vector<Rule>, std::vector<Update>> {
-  const std::vector<char> data{std::istreambuf_iterator{in}, {}};
+auto parse_input(std::string_view data) -> std::pair<std::vector<Rule>, std::vector<Update>> {
   auto sections =
       std::ranges::views::lazy_split(data, "\n\n"sv) |
       std::ranges::views::transform([](const auto& section) {
@@ -74,27 +76,50 @@ const auto is_valid = [](const std::set<Rule>& rules, const Update& update) {
   return true;
 };
 
-auto solve_part1(const auto& input) {
-  const auto rules = std::ranges::views::all(input.first) | std::ranges::to<std::set>();
+// The rules indexed both ways, and which updates already follow them
+struct Analysis {
+  std::set<Rule> rules;
+  std::multimap<Page, Page> all_predecessors;
+  std::vector<std::uint8_t> valid;  // Per update
+};
+
+auto analyze(const std::pair<std::vector<Rule>, std::vector<Update>>& input) {
+  Analysis result{
+      .rules = std::ranges::views::all(input.first) | std::ranges::to<std::set>(),
+      .all_predecessors = std::ranges::views::all(input.first) |
+                          std::ranges::views::transform([](const auto& rule) {
+                            return std::make_pair(rule.after, rule.before);
+                          }) |
+                          std::ranges::to<std::multimap>(),
+      .valid = {}};
+  result.valid = std::ranges::views::transform(input.second, [&](const auto& update) {
+                   return std::uint8_t(is_valid(result.rules, update));
+                 }) |
+                 std::ranges::to<std::vector>();
+  return result;
+}
 
+// Updates whose validity is `valid`
+auto updates_where(const auto& input, const Analysis& analysis, bool valid) {
+  return std::ranges::views::zip(input.second, analysis.valid) |
+         std::ranges::views::filter(
+             [valid](const auto& p) { return bool(std::get<1>(p)) == valid; }) |
+         std::ranges::views::keys;
+}
+
+auto solve_part1(const auto& input, const Analysis& analysis) {
   auto valid_updates =
-      std::ranges::views::filter(input.second,
-                                 [&](const auto& update) { return is_valid(rules, update); }) |
+      updates_where(input, analysis, true) |
       std::ranges::views::transform([](const auto& update) { return update[update.size() / 2]; });
   return std::ranges::fold_left(valid_updates, std::uint64_t{}, std::plus<>{});
 }
 
-auto solve_part2(const std::pair<std::vector<Rule>, std::vector<Update>>& input) {
-  const auto rules = std::ranges::views::all(input.first) | std::ranges::to<std::set>();
-  const auto all_predecessors = std::ranges::views::all(input.first) |
-                                std::ranges::views::transform([](const auto& rule) {
-                                  return std::make_pair(rule.after, rule.before);
-                                }) |
-                                std::ranges::to<std::multimap>();
+auto solve_part2(const std::pair<std::vector<Rule>, std::vector<Update>>& input,
+                 const Analysis& analysis) {
+  const auto& all_predecessors = analysis.all_predecessors;
 
   auto fixed_updates =
-      std::ranges::views::filter(input.second,
-                                 [&](const auto& update) { return !is_valid(rules, update); }) |
+      updates_where(input, analysis, false) |
       std::ranges::views::transform([&](const auto& update) {
         std::multimap<Page, Page> predecessors;
         for (const auto p : update) {
@@ -125,10 +150,14 @@ auto solve_part2(const std::pair<std::vector<Rule>, std::vector<Update>>& input)
   return std::ranges::fold_left(fixed_updates, std::uint64_t{}, std::plus<>{});
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day05
+
+namespace {
+
+const auto registered = aoc::register_analyzed_day(
+    "day05", [](std::string_view text) { return day05::parse_input(text); },
+    [](const auto& input) { return day05::analyze(input); },
+    [](const auto& input, const auto& analysis) { return day05::solve_part1(input, analysis); },
+    [](const auto& input, const auto& analysis) { return day05::solve_part2(input, analysis); });
+
+}  // namespace
@@ -0,0 +1,78 @@
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day06 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+constexpr std::array<Loc, 4> headings{
+    {{.row = -1, .col = 0}, {.row = 0, .col = 1}, {.row = 1, .col = 0}, {.row = 0, .col = -1}}};
+
+// Number of steps the guard takes to walk out of the room, unless it patrols forever
+auto patrol_length(const aoc::TextGrid& room, Loc guard) -> std::optional<std::size_t> {
+  // A patrol visiting every (tile, heading) pair once without leaving must be a loop
+  const auto step_bound =
+      (4UZ * std::size_t(room.row_count()) * std::size_t(room.col_count())) + 1UZ;
+  std::size_t heading{};
+  for (std::size_t step{}; step != step_bound; ++step) {
+    const Loc ahead = guard + headings[heading];
+    if (!room.contains(ahead)) {
+      return step;
+    }
+    if (room[ahead] == '#') {
+      heading = (heading + 1UZ) % headings.size();
+    } else {
+      guard = ahead;
+    }
+  }
+  return std::nullopt;
+}
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  while (true) {
+    aoc::TextGrid room{side, side, '.'};
+    for (Idx row{}; row != side; ++row) {
+      for (Idx col{}; col != side; ++col) {
+        if (random.chance(0.05)) {
+          room[Loc{row, col}] = '#';
+        }
+      }
+    }
+    // Random starts tend to leave in a handful of steps, so keep the longest of a few patrols
+    std::optional<Loc> guard;
+    std::size_t longest{};
+    for (auto attempt = 0; attempt != 16; ++attempt) {
+      const Loc candidate{random.uniform(Idx{}, side - 1), random.uniform(Idx{}, side - 1)};
+      if (room[candidate] == '.') {
+        const auto length = patrol_length(room, candidate);
+        if (length.has_value() && *length >= longest) {
+          guard = candidate;
+          longest = *length;
+        }
+      }
+    }
+    if (guard.has_value()) {
+      room[*guard] = '^';
+      return std::move(room).text();
+    }
+  }
+}
+
+}  // namespace day06
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day06",
+                                                 .unit = "grid side",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day06::generate});
+
+}  // namespace
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "counters.hpp"
+#include "day.hpp"
+#include "grid.hpp"
+#include "trace.hpp"
+
+namespace day06 {
+
+using aoc::Loc;
+
+enum class Tile : std::uint8_t {
+  open,
+  obstacle,
+  outside,
+};
+
+using Room = aoc::Grid<Tile>;
+
+struct Guard {
+  Loc loc;
+  Loc dir;
+
+  auto operator<=>(const Guard&) const = default;
+};
+
+auto parse_input(std::string_view data) {
+  Loc guard{};
+  auto room = aoc::parse_grid(data, Tile::outside, [&guard](const Loc loc, const char c) {
+    if (c == '^') {
+      guard = loc;
+    }
+    return c == '#' ? Tile::obstacle : Tile::open;
+  });
+
+  return std::make_pair(std::move(room), guard);
+}
+
+auto turn_right(const Loc& dir) { return Loc{.row = dir.col, .col = -dir.row}; }
+
+auto patrol(const Room& room, Guard guard) {
+  aoc::Grid<std::uint8_t> visited{room.row_count(), room.col_count(), 0, 0};
+  std::vector<Loc> result{guard.loc};
+  visited[guard.loc] = 1;
+
+  for (;;) {
+    const auto candidate = guard.loc + guard.dir;
+    const auto tile = room[candidate];
+    if (tile == Tile::outside) {
+      break;
+    }
+    if (tile == Tile::obstacle) {
+      guard.dir = turn_right(guard.dir);
+    } else {
+      guard.loc = candidate;
+      if (std::exchange(visited[candidate], 1) == 0) {
+        result.push_back(candidate);
+      }
+    }
+  }
+  return result;
+}
+
+auto solve_part1(const auto& input) {
+  return patrol(input.first, {input.second, Loc{.row = -1, .col = 0}}).size();
+}
+
+auto heading_bit(const Loc& dir) {
+  if (dir.row != 0) {
+    return std::uint8_t(dir.row < 0 ? 1 : 4);
+  }
+  return std::uint8_t(dir.col > 0 ? 2 : 8);
+}
+
+auto loops(const Room& room, Guard guard) {
+  const aoc::trace::Span span{"loops", "day06"};
+  AOC_COUNT("loop checks", 1);
+  aoc::Grid<std::uint8_t> headings{room.row_count(), room.col_count(), 0, 0};
+  headings[guard.loc] = heading_bit(guard.dir);
+  for (;;) {
+    AOC_COUNT("guard moves", 1);
+    const auto candidate = guard.loc + guard.dir;
+    if ((headings[candidate] & heading_bit(guard.dir)) != 0) {
+      return true;
+    }
+    const auto tile = room[candidate];
+    if (tile == Tile::outside) {
+      return false;
+    }
+    if (tile == Tile::obstacle) {
+      AOC_COUNT("guard turns", 1);
+      guard.dir = turn_right(guard.dir);
+    } else {
+      guard.loc = candidate;
+      headings[guard.loc] |= heading_bit(guard.dir);
+    }
+  }
+}
+
+auto solve_part2(const auto& input) {
+  const auto& [initial_room, start] = input;
+  const auto& guard = Guard{start, Loc{.row = -1, .col = 0}};
+  const auto candidates = patrol(initial_room, guard);
+  auto room = initial_room;
+  return std::ranges::count_if(std::views::drop(candidates, 1), [&](const Loc& new_obstacle) {
+    room[new_obstacle] = Tile::obstacle;
+    const auto result = loops(room, guard);
+    room[new_obstacle] = Tile::open;
+    return result;
+  });
+}
+
+}  // namespace day06
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day06", [](std::string_view text) { return day06::parse_input(text); },
+    [](const auto& input) { return day06::solve_part1(input); },
+    [](const auto& input) { return day06::solve_part2(input); });
+
+}  // namespace
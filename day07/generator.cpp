@@ -0,0 +1,72 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day07 {
+
+using Int = std::uint64_t;
+
+auto concatenate(Int left, Int right) {
+  Int shift{10};
+  while (shift <= right) {
+    shift *= Int{10};
+  }
+  return (left * shift) + right;
+}
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // Small enough for the sum of the results over the largest input not to overflow
+  constexpr Int bound{1'000'000'000'000};
+
+  std::string result;
+  std::vector<Int> terms;
+  for (std::size_t i{}; i != size; ++i) {
+    terms.resize(random.uniform(2UZ, 12UZ));
+    for (auto& term : terms) {
+      term = random.uniform(Int{1}, random.chance(0.7) ? Int{9} : Int{999});
+    }
+
+    Int value = terms.front();
+    for (const Int term : std::views::drop(terms, 1)) {
+      const auto candidate = [&] {
+        switch (random.uniform(0, 2)) {
+          case 0:
+            return value * term;
+          case 1:
+            return concatenate(value, term);
+          default:
+            return value + term;
+        }
+      }();
+      value = candidate < bound ? candidate : value + term;
+    }
+    if (random.chance(0.5)) {  // Most likely unreachable
+      value += random.uniform(Int{1}, Int{9});
+    }
+
+    std::format_to(std::back_inserter(result), "{}:", value);
+    for (const Int term : terms) {
+      std::format_to(std::back_inserter(result), " {}", term);
+    }
+    result.push_back('\n');
+  }
+  return result;
+}
+
+}  // namespace day07
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day07",
+                                                 .unit = "equations",
+                                                 .min_size = 1UZ,
+                                                 .max_size = 18'000'000UZ,
+                                                 .generate = day07::generate});
+
+}  // namespace
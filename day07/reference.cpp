@@ -1,32 +1,21 @@
 #include <algorithm>
 #include <cassert>
-#include <charconv>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
-#include <istream>
-#include <iterator>
-#include <print>
 #include <ranges>
 #include <span>
 #include <string_view>
-#include <system_error>
 #include <utility>
 #include <vector>
 
-using namespace std::string_view_literals;
+#include "day.hpp"
+#include "reference.hpp"
+#include "scanner.hpp"
 
-template <typename Numeric, typename Range>
-auto parse(Range&& rng) {
-  const auto token = std::forward<Range>(rng) | std::ranges::to<std::vector>();
-  Numeric result;  // NOLINT
-  [[maybe_unused]] const std::from_chars_result status =
-      std::from_chars(token.data(), std::next(token.data(), std::ptrdiff_t(token.size())), result);
-  assert(status.ec == std::errc{});
-  return result;
-}
+// Brute force over every combination of operators, the oracle of solution.cpp
+namespace day07::reference {
 
 using Int = std::uint64_t;
 
@@ -35,24 +24,19 @@ struct Equation {
   std::vector<Int> terms;
 };
 
-auto parse_input(std::istream&& in) {
-  std::vector<char> data{std::istreambuf_iterator<char>(in), {}};
-
-  return std::ranges::views::split(data, '\n') |
-         std::ranges::views::filter([](const auto& line) { return !line.empty(); }) |
-         std::ranges::views::transform([](const auto& line) {
-           auto sections = std::ranges::views::split(line, ": "sv);
-           auto it = sections.begin();
-           const auto result = parse<Int>(*it++);
-           auto terms = *it++ | std::ranges::views::split(' ') |
-                        std::ranges::views::transform([](const auto& token) {
-                          auto r = parse<Int>(token);
-                          return r;
-                        }) |
-                        std::ranges::to<std::vector>();
-           return Equation{result, std::move(terms)};
-         }) |
-         std::ranges::to<std::vector>();
+auto parse_input(std::string_view data) {
+  std::vector<Equation> result;
+  aoc::Scanner lines{data};
+  while (!lines.done()) {
+    aoc::Scanner numbers{lines.line()};
+    if (const auto value = numbers.next<Int>(); value.has_value()) {
+      auto& equation = result.emplace_back(*value, std::vector<Int>{});
+      while (const auto term = numbers.next<Int>()) {
+        equation.terms.push_back(*term);
+      }
+    }
+  }
+  return result;
 }
 
 enum class Operator : std::uint8_t {
@@ -144,10 +128,13 @@ struct Part2 {
 
 auto solve_part2(const auto& input) { return solve<Part2>(input); }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day07::reference
+
+namespace {
+
+const auto registered = aoc::register_reference(
+    "day07", 200UZ, [](std::string_view text) { return day07::reference::parse_input(text); },
+    [](const auto& input) { return day07::reference::solve_part1(input); },
+    [](const auto& input) { return day07::reference::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "parallel.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+
+namespace day07 {
+
+using Int = std::uint64_t;
+
+struct Equation {
+  Int result;
+  std::vector<Int> terms;
+};
+
+auto snapshot_fields(const Equation& equation) { return std::tie(equation.result, equation.terms); }
+
+// Equation on one line, nothing for a blank line
+auto parse_line(std::string_view line) -> std::optional<Equation> {
+  aoc::Scanner numbers{line};
+  const auto value = numbers.next<Int>();
+  if (!value.has_value()) {
+    return std::nullopt;
+  }
+  Equation result{.result = *value, .terms = {}};
+  while (const auto term = numbers.next<Int>()) {
+    result.terms.push_back(*term);
+  }
+  return result;
+}
+
+auto parse_input(std::string_view data) {
+  std::vector<Equation> result;
+  aoc::Scanner lines{data};
+  while (!lines.done()) {
+    if (auto equation = parse_line(lines.line()); equation.has_value()) {
+      result.push_back(std::move(*equation));
+    }
+  }
+  return result;
+}
+
+// Power of ten above `term`, by which concatenating it shifts the left operand
+auto concat_shift(Int term) {
+  auto result = Int{10};
+  while (result <= term) {
+    result *= Int{10};
+  }
+  return result;
+}
+
+// Whether the operators between `terms` can make `target`. The operators are evaluated left to
+// right, so the search undoes the last one first: the value before it must be the difference, the
+// quotient or the concatenation prefix of the target and the last term, which prunes most branches
+// at once, without enumerating the combinations.
+template <bool with_concat>
+auto can_make(std::span<const Int> terms, Int target) -> bool {
+  const auto last = terms.back();
+  if (terms.size() == 1UZ) {
+    return target == last;
+  }
+  const auto rest = terms.first(terms.size() - 1UZ);
+  if (target >= last && can_make<with_concat>(rest, target - last)) {
+    return true;
+  }
+  if (last == Int{} ? target == Int{}
+                    : target % last == Int{} && can_make<with_concat>(rest, target / last)) {
+    return true;
+  }
+  if constexpr (with_concat) {
+    const auto shift = concat_shift(last);
+    return target >= last && (target - last) % shift == Int{} &&
+           can_make<with_concat>(rest, (target - last) / shift);
+  }
+  return false;
+}
+
+template <bool with_concat>
+auto solve(const std::span<const Equation> input) {
+  return aoc::parallel_reduce(input, 64UZ, Int{}, [](const Equation& eq) {
+    assert(!eq.terms.empty());
+    return can_make<with_concat>(eq.terms, eq.result) ? eq.result : Int{};
+  });
+}
+
+auto solve_part1(const auto& input) { return solve<false>(input); }
+
+auto solve_part2(const auto& input) { return solve<true>(input); }
+
+}  // namespace day07
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day07", [](std::string_view text) { return day07::parse_input(text); },
+    [](const auto& input) { return day07::solve_part1(input); },
+    [](const auto& input) { return day07::solve_part2(input); });
+
+// The equations are independent, so each batch is summed and dropped as it arrives
+const auto registered_streaming = aoc::register_streaming_day(
+    "day07", [](std::string_view line) { return day07::parse_line(line); },
+    std::array<day07::Int, 2>{},
+    [](auto& sums, const auto& equations) {
+      sums[0] += day07::solve_part1(equations);
+      sums[1] += day07::solve_part2(equations);
+    },
+    [](const auto& sums) { return sums[0]; }, [](const auto& sums) { return sums[1]; });
+
+}  // namespace
@@ -0,0 +1,38 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day08 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  constexpr std::string_view frequencies =
+      "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const auto side = Idx(size);
+  aoc::TextGrid result{side, side, '.'};
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      if (random.chance(0.07)) {
+        result[Loc{row, col}] = random.pick(frequencies);
+      }
+    }
+  }
+  return std::move(result).text();
+}
+
+}  // namespace day08
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day08",
+                                                 .unit = "grid side",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day08::generate});
+
+}  // namespace
@@ -1,16 +1,19 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
-#include <fstream>
 #include <iterator>
 #include <map>
 #include <numeric>
-#include <print>
 #include <ranges>
 #include <set>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+
+namespace day08 {
+
 using Idx = std::int32_t;
 
 struct Loc {
@@ -99,9 +102,7 @@ class City {
   Idx col_count_;
 };
 
-auto parse_input(std::istream&& in) {
-  const std::vector<char> data{std::istreambuf_iterator{in}, {}};
-
+auto parse_input(std::string_view data) {
   const auto row_count = Idx(std::ranges::count(data, '\n'));
   const auto col_count = Idx(std::ranges::distance(
       std::ranges::views::take_while(data, [](const char c) { return c != '\n'; })));
@@ -124,10 +125,13 @@ auto solve_part1(const auto& input) { return input.basic_antinodes().size(); }
 
 auto solve_part2(const auto& input) { return input.advanced_antinodes().size(); }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day08
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day08", [](std::string_view text) { return day08::parse_input(text); },
+    [](const auto& input) { return day08::solve_part1(input); },
+    [](const auto& input) { return day08::solve_part2(input); });
+
+}  // namespace
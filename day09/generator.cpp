@@ -0,0 +1,35 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "generator.hpp"
+
+namespace day09 {
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // The map alternates files and free spans, starting and ending with a file
+  const auto digit_count = size % 2UZ == 0UZ ? size - 1UZ : size;
+  std::string result(digit_count, '0');
+  for (std::size_t i{}; i != digit_count; ++i) {
+    // Files take at least one block, the free spans between them may be empty
+    result[i] = char('0' + random.uniform(i % 2UZ == 0UZ ? 1 : 0, 9));
+  }
+  result.push_back('\n');
+  return result;
+}
+
+}  // namespace day09
+
+namespace {
+
+// File ids are 16-bit, and the largest one is reserved for free blocks
+constexpr auto max_file_count = std::size_t(std::numeric_limits<std::uint16_t>::max());
+
+const auto registered = aoc::register_generator({.day = "day09",
+                                                 .unit = "disk map digits, rounded down to odd",
+                                                 .min_size = 1UZ,
+                                                 .max_size = (2UZ * max_file_count) - 1UZ,
+                                                 .generate = day09::generate});
+
+}  // namespace
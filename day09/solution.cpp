@@ -2,23 +2,30 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iterator>
 #include <limits>
 #include <list>
 #include <numeric>
-#include <print>
 #include <ranges>
 #include <span>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day09 {
+
 using Id = std::uint16_t;
 using FileSize = std::uint8_t;
 
-auto parse_input(std::istream&& in) {
-  return std::ranges::views::istream<char>(in) |
-         std::ranges::views::take_while([](const char c) { return c != '\n'; }) |
+constexpr auto parse_input(std::string_view data) {
+  return data | std::ranges::views::take_while([](const char c) { return c != '\n'; }) |
          std::ranges::views::transform([](const char c) { return FileSize(c - '0'); }) |
          std::ranges::to<std::vector>();
 }
@@ -146,10 +153,22 @@ auto solve_part2(const auto& input) {
   return checksum(filesystem);
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_filemap = aoc::freeze<[] { return parse_input(aoc::embedded::text); }>();
+#endif
+
+}  // namespace day09
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day09", [](std::string_view text) { return day09::parse_input(text); },
+    [](const auto& input) { return day09::solve_part1(input); },
+    [](const auto& input) { return day09::solve_part2(input); });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse(
+    "day09", [] { return std::any{aoc::thaw(day09::embedded_filemap)}; });
+#endif
+
+}  // namespace
@@ -0,0 +1,52 @@
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day10 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+constexpr std::array<Loc, 4> steps{
+    {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  aoc::TextGrid result{side, side, '.'};
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      result[Loc{row, col}] = char('0' + random.uniform(0, 9));
+    }
+  }
+
+  // Uniform heights hardly ever line up, so carve hiking trails going from 0 up to 9 as well
+  const auto trail_count = (std::size_t(side) * std::size_t(side)) / 20UZ;
+  for (std::size_t i{}; i != trail_count; ++i) {
+    Loc loc{random.uniform(Idx{}, side - 1), random.uniform(Idx{}, side - 1)};
+    Loc previous = loc;
+    for (char height = '0'; height != '9' + 1; ++height) {
+      result[loc] = height;
+      Loc next = loc + random.pick(steps);
+      while (next == previous || !result.contains(next)) {
+        next = loc + random.pick(steps);
+      }
+      previous = std::exchange(loc, next);
+    }
+  }
+  return std::move(result).text();
+}
+
+}  // namespace day10
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day10",
+                                                 .unit = "grid side",
+                                                 .min_size = 2UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day10::generate});
+
+}  // namespace
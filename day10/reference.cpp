@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "counters.hpp"
+#include "day.hpp"
+#include "reference.hpp"
+#include "grid.hpp"
+
+// Search of every trail from every trailhead, the oracle of solution.cpp
+namespace day10::reference {
+
+using aoc::Loc;
+
+using Height = std::uint8_t;
+
+constexpr auto no_height = std::numeric_limits<Height>::max();
+
+using Terrain = aoc::Grid<Height>;
+
+auto parse_input(std::string_view data) {
+  return aoc::parse_grid(data, no_height,
+                         [](Loc /*loc*/, const char c) { return Height(c - '0'); });
+}
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+
+auto trailhead_score_impl(const Terrain& terrain, Loc current_loc, Height current_height,
+                          std::set<Loc>& trailends) {
+  if (terrain[current_loc] != current_height) {
+    return;
+  }
+
+  if (current_height == Height{9}) {
+    trailends.insert(current_loc);
+    return;
+  }
+
+  std::ranges::for_each(terrain.neighbors(current_loc, moves), [&](const Loc& candidate) {
+    trailhead_score_impl(terrain, candidate, current_height + Height{1}, trailends);
+  });
+}
+
+auto trailhead_score(const Terrain& terrain, Loc start) {
+  std::set<Loc> trailends;
+  trailhead_score_impl(terrain, start, {}, trailends);
+  return trailends.size();
+}
+
+auto solve_part1(const auto& input) {
+  return std::ranges::fold_left(
+      input.locs() | std::ranges::views::transform(
+                         [&](const Loc& start) { return trailhead_score(input, start); }),
+      std::size_t{}, std::plus<>{});
+}
+
+auto trail_count_impl(const Terrain& terrain, Loc current_loc, Height current_height) {
+  AOC_COUNT("calls", 1);
+  AOC_COUNT_MAX("recursion depth", current_height + 1);
+  if (terrain[current_loc] != current_height) {
+    AOC_COUNT("candidates pruned", 1);
+    return 0UZ;
+  }
+
+  if (current_height == Height{9}) {
+    return 1UZ;
+  }
+
+  return std::ranges::fold_left(
+      std::ranges::views::transform(terrain.neighbors(current_loc, moves),
+                                    [&](const Loc& candidate) {
+                                      return trail_count_impl(terrain, candidate,
+                                                              current_height + Height{1});
+                                    }),
+      0UZ, std::plus<>{});
+}
+
+auto trail_count(const Terrain& terrain, Loc start) { return trail_count_impl(terrain, start, {}); }
+
+auto solve_part2(const auto& input) {
+  return std::ranges::fold_left(
+      input.locs() | std::ranges::views::transform(
+                         [&](const Loc& start) { return trail_count(input, start); }),
+      std::size_t{}, std::plus<>{});
+}
+
+}  // namespace day10::reference
+
+namespace {
+
+const auto registered = aoc::register_reference(
+    "day10", 200UZ, [](std::string_view text) { return day10::reference::parse_input(text); },
+    [](const auto& input) { return day10::reference::solve_part1(input); },
+    [](const auto& input) { return day10::reference::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#include "counters.hpp"
+#include "day.hpp"
+#include "grid.hpp"
+#include "parallel.hpp"
+
+namespace day10 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+using Height = std::uint8_t;
+
+constexpr auto no_height = std::numeric_limits<Height>::max();
+
+using Terrain = aoc::Grid<Height>;
+
+auto parse_input(std::string_view data) {
+  return aoc::parse_grid(data, no_height,
+                         [](Loc /*loc*/, const char c) { return Height(c - '0'); });
+}
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+
+constexpr Height top{9};
+
+using Index = Terrain::Index;
+
+// Indices of the cells of each height, the border excluded
+auto cells_by_height(const Terrain& terrain) {
+  std::array<std::vector<Index>, top + 1UZ> result;
+  for (const auto& [index, height] : std::views::enumerate(terrain.cells())) {
+    if (height <= top) {
+      result[height].push_back(Index(index));
+    }
+  }
+  return result;
+}
+
+// Trails climb one unit per step, so those of a trailhead stay within `top` steps of it
+constexpr auto reach = Idx{top};
+constexpr auto reach_side = std::size_t((Idx{2} * reach) + Idx{1});
+
+// Walks up the trails of a trailhead once, marking the cells it reached in the window of those
+// within reach, so that every summit is counted once
+auto summits_reached(const Terrain& terrain, const Index start) {
+  const Loc corner = terrain.loc(start) - Loc{.row = reach, .col = reach};
+  std::bitset<reach_side * reach_side> reached;
+  const auto first_visit = [&](const Index index) {
+    const Loc offset = terrain.loc(index) - corner;
+    const auto bit = (std::size_t(offset.row) * reach_side) + std::size_t(offset.col);
+    const auto result = !reached.test(bit);
+    reached.set(bit);
+    return result;
+  };
+  std::array<Index, reach_side * reach_side> pending;  // Each cell is pushed once at most
+  std::size_t pending_count{};
+  first_visit(start);
+  pending[pending_count++] = start;
+  std::size_t result{};
+  while (pending_count != 0UZ) {
+    const auto current = pending[--pending_count];
+    AOC_COUNT("cells visited", 1);
+    const auto height = terrain[current];
+    if (height == top) {
+      ++result;
+      continue;
+    }
+    for (const Index next : terrain.neighbors(current, moves)) {
+      if (terrain[next] == height + Height{1} && first_visit(next)) {
+        pending[pending_count++] = next;
+      }
+    }
+  }
+  return result;
+}
+
+// The trailheads are independent, so they are shared among the threads
+auto solve_part1(const Terrain& terrain) {
+  const auto levels = cells_by_height(terrain);
+  return aoc::parallel_reduce(levels.front(), 64UZ, 0UZ, [&](const Index start) {
+    return summits_reached(terrain, start);
+  });
+}
+
+// The number of trails from a cell is the sum of those from its neighbours one step higher, so
+// the counts are summed down from the summits one height at a time
+auto solve_part2(const Terrain& terrain) {
+  const auto levels = cells_by_height(terrain);
+  std::vector<std::size_t> trail_counts(terrain.cell_count());
+  for (const Index summit : levels.back()) {
+    trail_counts[summit] = 1UZ;
+  }
+  for (auto height = std::size_t{top}; height-- != 0UZ;) {
+    for (const Index index : levels[height]) {
+      for (const Index next : terrain.neighbors(index, moves)) {
+        if (terrain[next] == Height(height + 1UZ)) {
+          trail_counts[index] += trail_counts[next];
+        }
+      }
+    }
+  }
+  return std::ranges::fold_left(levels.front() | std::views::transform([&](const Index start) {
+                                  return trail_counts[start];
+                                }),
+                                std::size_t{}, std::plus<>{});
+}
+
+}  // namespace day10
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day10", [](std::string_view text) { return day10::parse_input(text); },
+    [](const auto& input) { return day10::solve_part1(input); },
+    [](const auto& input) { return day10::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,33 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+
+#include "generator.hpp"
+
+namespace day11 {
+
+using Int = std::uint64_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::string result;
+  for (std::size_t i{}; i != size; ++i) {
+    std::format_to(std::back_inserter(result), "{}{}", i == 0UZ ? "" : " ",
+                   random.uniform(Int{}, Int{9'999'999}));
+  }
+  result.push_back('\n');
+  return result;
+}
+
+}  // namespace day11
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day11",
+                                                 .unit = "stones",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day11::generate});
+
+}  // namespace
@@ -1,19 +1,33 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
-#include <map>
 #include <optional>
-#include <print>
 #include <ranges>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+#include "flat_hash.hpp"
+#include "scanner.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day11 {
+
 using Int = std::uint64_t;
 
-auto parse_input(std::istream&& in) {
-  return std::ranges::views::istream<Int>(in) | std::ranges::to<std::vector>();
+constexpr auto parse_input(std::string_view data) {
+  std::vector<Int> result;
+  aoc::Scanner scanner{data};
+  while (const auto stone = scanner.next<Int>()) {
+    result.push_back(*stone);
+  }
+  return result;
 }
 
 auto split(Int i) -> std::optional<std::pair<Int, Int>> {
@@ -31,8 +45,11 @@ auto split(Int i) -> std::optional<std::pair<Int, Int>> {
   return {{i / divisor, i % divisor}};
 }
 
-auto blink(const std::map<Int, std::size_t>& stones) {
-  std::map<Int, std::size_t> result;
+using Stones = aoc::FlatMap<Int, std::size_t>;  // Stone counts by engraving
+
+auto blink(const Stones& stones) {
+  Stones result;
+  result.reserve(stones.size());
   for (const auto& [i, count] : stones) {
     if (i == Int{0}) {
       result[Int{1}] += count;
@@ -47,7 +64,7 @@ auto blink(const std::map<Int, std::size_t>& stones) {
 }
 
 auto solve(const auto& input, std::size_t blinks) {
-  std::map<Int, std::size_t> stones;
+  Stones stones;
   for (const auto i : input) {
     stones[i] += 1UZ;
   }
@@ -60,10 +77,22 @@ auto solve(const auto& input, std::size_t blinks) {
 auto solve_part1(const auto& input) { return solve(input, 25UZ); }
 auto solve_part2(const auto& input) { return solve(input, 75UZ); }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_stones = aoc::freeze<[] { return parse_input(aoc::embedded::text); }>();
+#endif
+
+}  // namespace day11
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day11", [](std::string_view text) { return day11::parse_input(text); },
+    [](const auto& input) { return day11::solve_part1(input); },
+    [](const auto& input) { return day11::solve_part2(input); });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse(
+    "day11", [] { return std::any{aoc::thaw(day11::embedded_stones)}; });
+#endif
+
+}  // namespace
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day12 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+constexpr std::array<Loc, 4> steps{
+    {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  aoc::TextGrid result{side, side, '.'};
+
+  // Grow plant regions around random seeds, one layer at a time, until the garden is covered
+  std::vector<Loc> frontier;
+  const auto seed_count = std::max(1UZ, (std::size_t(side) * std::size_t(side)) / 50UZ);
+  for (std::size_t i{}; i != seed_count; ++i) {
+    const Loc loc{random.uniform(Idx{}, side - 1), random.uniform(Idx{}, side - 1)};
+    if (result[loc] == '.') {
+      result[loc] = char('A' + random.uniform(0, 25));
+      frontier.push_back(loc);
+    }
+  }
+  std::vector<Loc> next_frontier;
+  while (!frontier.empty()) {
+    random.shuffle(frontier);
+    for (const Loc loc : frontier) {
+      for (const Loc step : steps) {
+        const Loc neighbor = loc + step;
+        if (result.contains(neighbor) && result[neighbor] == '.') {
+          result[neighbor] = result[loc];
+          next_frontier.push_back(neighbor);
+        }
+      }
+    }
+    std::swap(frontier, next_frontier);
+    next_frontier.clear();
+  }
+  return std::move(result).text();
+}
+
+}  // namespace day12
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day12",
+                                                 .unit = "grid side",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day12::generate});
+
+}  // namespace
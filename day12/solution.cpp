@@ -1,79 +1,42 @@
 #include <algorithm>
 #include <array>
-#include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <map>
-#include <optional>
-#include <print>
+#include <memory_resource>
 #include <ranges>
 #include <set>
 #include <span>
+#include <string_view>
 #include <utility>
 #include <vector>
 
-using Idx = std::int32_t;
-using Crop = char;
-
-struct Loc {
-  Idx row;
-  Idx col;
-
-  auto operator<=>(const Loc& other) const = default;
-};
-
-auto operator+(const Loc& left, const Loc& right) {
-  return Loc{.row = left.row + right.row, .col = left.col + right.col};
-}
+#include "arena.hpp"
+#include "day.hpp"
+#include "grid.hpp"
 
-auto operator-(const Loc& left, const Loc& right) {
-  return Loc{.row = left.row - right.row, .col = left.col - right.col};
-}
-
-class Field {
- public:
-  auto row_count() const { return row_count_; }
-  auto col_count() const { return col_count_; }
-
-  auto operator[](Loc loc) const -> std::optional<Crop> {
-    const auto& [row, col] = loc;
-    if (row < 0 || row >= row_count_ || col < 0 || col >= col_count_) {
-      return std::nullopt;
-    }
-    const decltype(tiles_)::size_type entry = (row * row_count_) + col;
-    return {tiles_[entry]};
-  }
+namespace day12 {
 
-  Field(std::vector<Crop> tiles, Idx row_count, Idx col_count)
-      : tiles_{std::move(tiles)}, row_count_{row_count}, col_count_{col_count} {
-    assert(std::cmp_equal(row_count_ * col_count_, tiles_.size()));
-  }
+using aoc::Idx;
+using aoc::Loc;
 
- private:
-  std::vector<Crop> tiles_;
-  Idx row_count_;
-  Idx col_count_;
-};
-
-auto parse_input(std::istream&& in) {
-  const std::vector<char> data{std::istreambuf_iterator{in}, {}};
+using Crop = char;
 
-  const auto row_count = Idx(std::ranges::count(data, '\n'));
-  const auto col_count = Idx(std::ranges::distance(
-      std::ranges::views::take_while(data, [](const char c) { return c != '\n'; })));
-  auto crops = std::ranges::views::filter(data, [](const char c) { return c != '\n'; }) |
-               std::ranges::to<std::vector>();
+using Field = aoc::Grid<Crop>;
 
-  return Field{std::move(crops), row_count, col_count};
+auto parse_input(std::string_view data) {
+  return aoc::parse_grid(data, Crop{}, [](Loc /*loc*/, const char c) { return c; });
 }
 
 constexpr std::array<Loc, 4> moves{
     {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
 
+// Boundary tiles mapped to their neighbors across the boundary
+using Perimeter = std::pmr::map<Loc, std::pmr::vector<Loc>>;
+
 struct Region {
-  std::set<Loc> tiles;
-  std::map<Loc, std::vector<Loc>> inner_perimeter;
-  std::map<Loc, std::vector<Loc>> outer_perimeter;
+  std::pmr::set<Loc> tiles;
+  Perimeter inner_perimeter;
+  Perimeter outer_perimeter;
 
   auto price() const;
   auto discount_price() const;
@@ -100,8 +63,7 @@ auto Region::discount_price() const {
     return boundaries.size() - 1UZ;
   };
 
-  const auto false_corner_count = [&](const std::pair<const Loc, std::vector<Loc>>& entry,
-                                      const std::map<Loc, std::vector<Loc>>& dual) {
+  const auto false_corner_count = [&](const Perimeter::value_type& entry, const Perimeter& dual) {
     return std::ranges::count_if(
         std::ranges::views::cartesian_product(std::ranges::views::all(entry.second),
                                               std::ranges::views::all(entry.second)),
@@ -128,17 +90,18 @@ auto Region::discount_price() const {
          tiles.size();
 }
 
-auto compute_region(const Field& field, Loc start) {
-  Region result{.tiles = {start}, .inner_perimeter = {}, .outer_perimeter = {}};
+auto compute_region(const Field& field, Loc start, aoc::Arena& arena) {
+  Region result{.tiles = std::pmr::set<Loc>{{start}, &arena},
+                .inner_perimeter = Perimeter{&arena},
+                .outer_perimeter = Perimeter{&arena}};
 
   std::vector<Loc> front{start};
-  const auto region_crop = *field[start];
+  const auto region_crop = field[start];
 
   while (!front.empty()) {
     const auto loc = front.back();
     front.pop_back();
-    for (const Loc& m : moves) {
-      const Loc neighbor = loc + m;
+    for (const Loc& neighbor : field.neighbors(loc, moves)) {
       if (!result.tiles.contains(neighbor)) {
         if (field[neighbor] == region_crop) {
           result.tiles.insert(neighbor);
@@ -156,22 +119,19 @@ auto compute_region(const Field& field, Loc start) {
 template <auto cost_function>
 auto solve(const Field& input) {
   std::uint64_t price{};
-  std::set<Loc> done;
-
-  auto all_tiles =
-      std::ranges::views::cartesian_product(std::ranges::views::iota(Idx{}, input.row_count()),
-                                            std::ranges::views::iota(Idx{}, input.col_count())) |
-      std::ranges::views::transform(
-          [&](const auto& p) { return Loc{.row = std::get<0>(p), .col = std::get<1>(p)}; });
+  aoc::Grid<std::uint8_t> done{input.row_count(), input.col_count(), 0, 0};
+  auto& arena = aoc::thread_arena(0UZ);
+  const aoc::ArenaUsage usage{&arena};
 
-  auto it = all_tiles.begin();
-  while (it != all_tiles.end()) {
-    auto region = compute_region(input, *it++);
+  for (const Loc& loc : input.locs()) {
+    if (done[loc] != 0) {
+      continue;
+    }
+    arena.reset();  // The previous region is gone
+    const auto region = compute_region(input, loc, arena);
     price += (region.*cost_function)();
-
-    done.merge(region.tiles);
-    while (it != all_tiles.end() && done.contains(*it)) {
-      ++it;
+    for (const Loc& tile : region.tiles) {
+      done[tile] = 1;
     }
   }
 
@@ -181,10 +141,13 @@ auto solve(const Field& input) {
 auto solve_part1(const auto& input) { return solve<&Region::price>(input); }
 auto solve_part2(const auto& input) { return solve<&Region::discount_price>(input); }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day12
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day12", [](std::string_view text) { return day12::parse_input(text); },
+    [](const auto& input) { return day12::solve_part1(input); },
+    [](const auto& input) { return day12::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+
+#include "generator.hpp"
+
+namespace day13 {
+
+using Idx = std::int32_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::string result;
+  for (std::size_t i{}; i != size; ++i) {
+    Idx ax{};
+    Idx ay{};
+    Idx bx{};
+    Idx by{};
+    // The buttons move along distinct directions, and pressing A is never the obvious choice
+    do {
+      ax = random.uniform(Idx{10}, Idx{99});
+      ay = random.uniform(Idx{10}, Idx{99});
+      bx = random.uniform(Idx{10}, Idx{99});
+      by = random.uniform(Idx{10}, Idx{99});
+    } while ((ax * by) == (ay * bx) || (ax >= 3 * bx && ay >= 3 * by));
+
+    const auto a_pushes = random.uniform(Idx{}, Idx{100});
+    const auto b_pushes = random.uniform(Idx{}, Idx{100});
+    auto x = (a_pushes * ax) + (b_pushes * bx);
+    auto y = (a_pushes * ay) + (b_pushes * by);
+    if (random.chance(0.5)) {  // Most likely out of reach
+      x += random.uniform(Idx{1}, Idx{9});
+    }
+
+    std::format_to(std::back_inserter(result),
+                   "{}Button A: X+{}, Y+{}\nButton B: X+{}, Y+{}\nPrize: X={}, Y={}\n",
+                   i == 0UZ ? "" : "\n", ax, ay, bx, by, x, y);
+  }
+  return result;
+}
+
+}  // namespace day13
+
+namespace {
+
+// At most 400 tokens per machine, summed up in 32 bits
+const auto registered = aoc::register_generator({.day = "day13",
+                                                 .unit = "claw machines",
+                                                 .min_size = 1UZ,
+                                                 .max_size = 5'000'000UZ,
+                                                 .generate = day13::generate});
+
+}  // namespace
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#include "day.hpp"
+#include "parallel.hpp"
+#include "scanner.hpp"
+
+namespace day13 {
+
+using Idx = std::int32_t;
+
+struct Loc {
+  Idx row;
+  Idx col;
+
+  auto operator<=>(const Loc& other) const = default;
+};
+
+auto operator+(const Loc& left, const Loc& right) {
+  return Loc{.row = left.row + right.row, .col = left.col + right.col};
+}
+
+auto operator-(const Loc& left, const Loc& right) {
+  return Loc{.row = left.row - right.row, .col = left.col - right.col};
+}
+
+struct Game {
+  Loc button_a;
+  Loc button_b;
+  Loc target;
+};
+
+auto parse_input(std::string_view content) {
+  std::vector<Game> result;
+  aoc::Scanner scanner{content};
+  // Every game is made of three lines holding two coordinates each
+  while (const auto first = scanner.next<Idx>()) {
+    const auto parse = [&scanner](Idx row) { return Loc{.row = row, .col = *scanner.next<Idx>()}; };
+    const Loc button_a = parse(*first);
+    const Loc button_b = parse(*scanner.next<Idx>());
+    const Loc target = parse(*scanner.next<Idx>());
+    result.push_back(Game{.button_a = button_a, .button_b = button_b, .target = target});
+  }
+  return result;
+}
+
+auto button_a_dominates(const Game& game) {
+  return game.button_a.row >= 3 * game.button_b.row && game.button_a.col >= 3 * game.button_b.col;
+}
+
+using PushCount = std::int32_t;
+using TokenCount = std::int32_t;
+
+auto operator*(Idx factor, const Loc& base) {
+  return Loc{.row = base.row * factor, .col = base.col * factor};
+}
+
+auto operator/(const Loc& left, const Loc& right) {
+  return std::min(left.row / right.row, left.col / right.col);
+}
+
+auto least_tokens_to_win(const Game& game) -> std::optional<TokenCount> {
+  assert(!button_a_dominates(game));
+  for (PushCount b_pushes = game.target / game.button_b; b_pushes >= PushCount{}; --b_pushes) {
+    const auto remainder = game.target - (b_pushes * game.button_b);
+    const PushCount a_pushes = remainder / game.button_a;
+    if (remainder == a_pushes * game.button_a) {
+      return TokenCount{(3 * a_pushes) + b_pushes};
+    }
+  }
+  return std::nullopt;
+}
+
+auto solve_part1(const auto& input) {
+  return aoc::parallel_reduce(input, 16UZ, TokenCount{}, [](const Game& game) {
+    return least_tokens_to_win(game).value_or(TokenCount{});
+  });
+}
+
+auto solve_part2(const auto& input) { return 0; }
+
+}  // namespace day13
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day13", [](std::string_view text) { return day13::parse_input(text); },
+    [](const auto& input) { return day13::solve_part1(input); },
+    [](const auto& input) { return day13::solve_part2(input); });
+
+}  // namespace
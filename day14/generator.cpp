@@ -0,0 +1,53 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day14 {
+
+using Idx = std::int32_t;
+
+constexpr Idx row_count{103};
+constexpr Idx col_count{101};
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // Pick the distinct tiles the robots all stand on at some moment, and run the clock backwards
+  std::vector<Idx> tiles(std::size_t(row_count * col_count));
+  std::iota(tiles.begin(), tiles.end(), Idx{});
+  random.shuffle(tiles);
+  tiles.resize(size);
+  const auto moment = random.uniform(Idx{}, (row_count * col_count) - 1);
+
+  std::string result;
+  for (const auto tile : tiles) {
+    const auto row_velocity = random.uniform(-row_count + 1, row_count - 1);
+    const auto col_velocity = random.uniform(-col_count + 1, col_count - 1);
+    const auto rewind = [moment](Idx pos, Idx velocity, Idx count) {
+      const auto offset = (std::int64_t(velocity) * moment) % count;
+      return Idx((pos - offset + (2 * count)) % count);
+    };
+    std::format_to(std::back_inserter(result), "p={},{} v={},{}\n",
+                   rewind(tile % col_count, col_velocity, col_count),
+                   rewind(tile / col_count, row_velocity, row_count), col_velocity, row_velocity);
+  }
+  return result;
+}
+
+}  // namespace day14
+
+namespace {
+
+// Beyond it the robots cannot stand on distinct tiles, and the search of part #2 never ends
+const auto registered =
+    aoc::register_generator({.day = "day14",
+                             .unit = "robots",
+                             .min_size = 1UZ,
+                             .max_size = std::size_t(day14::row_count * day14::col_count),
+                             .generate = day14::generate});
+
+}  // namespace
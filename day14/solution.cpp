@@ -1,16 +1,19 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
-#include <fstream>
 #include <functional>
-#include <ios>
 #include <optional>
-#include <print>
 #include <ranges>
-#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+
+namespace day14 {
+
 using Idx = std::int32_t;
 
 struct Loc {
@@ -33,29 +36,29 @@ struct Robot {
   Loc vel;
 };
 
-auto parse_input(std::istream&& in) {
-  const auto content =
-      std::ranges::istream_view<char>{in >> std::noskipws} | std::ranges::to<std::string>();
-  return std::views::split(content, '\n') |
-         std::views::filter([](const auto& line) { return !empty(line); }) |
-         std::views::transform([](const auto& line) {
-           auto sections = line | std::views::lazy_split(' ');
-           auto section_it = std::ranges::begin(sections);
-           const auto parse = [](const auto& section) {
-             auto coords = section | std::views::drop(2) | std::views::lazy_split(',') |
-                           std::views::transform([](const auto& token) {
-                             return std::stoi(token | std::ranges::to<std::string>());
-                           });
-             auto coords_it = std::ranges::begin(coords);
-             const auto col = *coords_it++;
-             const auto row = *coords_it++;
-             return Loc{row, col};
-           };
-           const auto pos = parse(*section_it++);
-           const auto vel = parse(*section_it++);
-           return Robot{pos, vel};
-         }) |
-         std::ranges::to<std::vector>();
+auto parse_input(std::string_view content) {
+  std::vector<Robot> result;
+  aoc::Scanner scanner{content};
+  while (const auto pos_col = scanner.next<Idx>()) {
+    const auto pos_row = *scanner.next<Idx>();
+    const auto vel_col = *scanner.next<Idx>();
+    const auto vel_row = *scanner.next<Idx>();
+    result.push_back(Robot{.pos = Loc{pos_row, *pos_col}, .vel = Loc{vel_row, vel_col}});
+  }
+  return result;
+}
+
+// Robot on one line, for the streaming mode
+auto parse_line(std::string_view line) -> std::optional<Robot> {
+  aoc::Scanner scanner{line};
+  const auto pos_col = scanner.next<Idx>();
+  if (!pos_col.has_value()) {
+    return std::nullopt;
+  }
+  const auto pos_row = *scanner.next<Idx>();
+  const auto vel_col = *scanner.next<Idx>();
+  const auto vel_row = *scanner.next<Idx>();
+  return Robot{.pos = Loc{pos_row, *pos_col}, .vel = Loc{vel_row, vel_col}};
 }
 
 class Area {
@@ -131,10 +134,23 @@ auto solve_part2(const auto& input) {
   return i;
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day14
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day14", [](std::string_view text) { return day14::parse_input(text); },
+    [](const auto& input) { return day14::solve_part1(input); },
+    [](const auto& input) { return day14::solve_part2(input); });
+
+// Part 2 moves all the robots together, so they are gathered as they arrive
+const auto registered_streaming = aoc::register_streaming_day(
+    "day14", [](std::string_view line) { return day14::parse_line(line); },
+    std::vector<day14::Robot>{},
+    [](auto& robots, const auto& batch) {
+      robots.insert(robots.end(), batch.begin(), batch.end());
+    },
+    [](const auto& robots) { return day14::solve_part1(robots); },
+    [](const auto& robots) { return day14::solve_part2(robots); });
+
+}  // namespace
@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day15 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  aoc::TextGrid warehouse{side, side, '.'};
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      const Loc loc{row, col};
+      if (row == Idx{} || col == Idx{} || row == side - 1 || col == side - 1 ||
+          random.chance(0.05)) {
+        warehouse[loc] = '#';
+      } else if (random.chance(0.4)) {
+        warehouse[loc] = 'O';
+      }
+    }
+  }
+  const Loc robot{random.uniform(Idx{1}, side - 2), random.uniform(Idx{1}, side - 2)};
+  warehouse[robot] = '@';
+
+  std::string result = std::move(warehouse).text();
+  result.push_back('\n');
+  // As many moves as eight times the warehouse area, in lines of a thousand
+  constexpr std::string_view moves = "^v<>";
+  const auto move_count = 8UZ * size * size;
+  for (std::size_t i{}; i != move_count; ++i) {
+    result.push_back(random.pick(moves));
+    if ((i + 1UZ) % 1000UZ == 0UZ || i + 1UZ == move_count) {
+      result.push_back('\n');
+    }
+  }
+  return result;
+}
+
+}  // namespace day15
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day15",
+                                                 .unit = "warehouse side",
+                                                 .min_size = 3UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day15::generate});
+
+}  // namespace
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "grid.hpp"
+
+namespace day15 {
+
+using namespace std::string_view_literals;
+
+using aoc::Idx;
+using aoc::Loc;
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+
+enum class Instruction : std::uint8_t {
+  up,
+  down,
+  left,
+  right,
+};
+
+enum class Tile : std::uint8_t {
+  empty,
+  wall,
+  crate,
+};
+
+struct Input {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  aoc::Grid<Tile> warehouse;
+  Loc robot;
+  std::vector<Instruction> instructions;
+};
+
+auto snapshot_fields(const Input& input) {
+  return std::tie(input.warehouse, input.robot, input.instructions);
+}
+
+auto parse_input(std::string_view content) {
+  auto sections = std::views::split(content, "\n\n"sv);
+
+  auto section = sections.begin();
+  auto warehouse_section = *section++;
+
+  Loc robot{};
+  auto warehouse =
+      aoc::parse_grid(warehouse_section, Tile::wall, [&robot](const Loc loc, const char tile) {
+        switch (tile) {
+          case '#':
+            return Tile::wall;
+          case 'O':
+            return Tile::crate;
+          case '@':
+            robot = loc;
+            return Tile::empty;
+          case '.':
+            return Tile::empty;
+          default:
+            std::unreachable();
+        }
+      });
+
+  std::vector<Instruction> instructions;
+
+  auto instruction_section = *section++;
+
+  for (const char c :
+       instruction_section | std::views::filter([](const char c) { return c != '\n'; })) {
+    const auto i = [](const char c) {
+      switch (c) {
+        case '^':
+          return Instruction::up;
+        case 'v':
+          return Instruction::down;
+        case '<':
+          return Instruction::left;
+        case '>':
+          return Instruction::right;
+        default:
+          std::unreachable();
+      }
+    }(c);
+    instructions.push_back(i);
+  }
+
+  return Input{
+      .warehouse = std::move(warehouse), .robot = robot, .instructions = std::move(instructions)};
+}
+
+auto gps_coordinates(Loc loc) { return (Idx{100} * loc.row) + loc.col; }
+
+auto solve_part1(const auto& input) {
+  auto warehouse = input.warehouse;
+  auto robot = input.robot;
+
+  for (const Loc move : std::views::transform(
+           input.instructions, [](const auto i) { return moves[std::to_underlying(i)]; })) {
+    const auto target = robot + move;
+    auto space = target;
+    while (warehouse[space] == Tile::crate) {
+      space = space + move;
+    }
+    if (warehouse[space] != Tile::wall) {
+      if (space != target) {
+        warehouse[space] = Tile::crate;
+        warehouse[target] = Tile::empty;
+      }
+      robot = target;
+    }
+  }
+  return std::ranges::fold_left(warehouse.locs(), 0UZ, [&warehouse](const auto acc, const Loc& x) {
+    return acc + (warehouse[x] == Tile::crate ? gps_coordinates(x) : Idx{});
+  });
+}
+
+auto solve_part2(const auto& input) { return 0; }
+
+}  // namespace day15
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day15", [](std::string_view text) { return day15::parse_input(text); },
+    [](const auto& input) { return day15::solve_part1(input); },
+    [](const auto& input) { return day15::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "generator.hpp"
+
+namespace day16 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  // Junctions sit on odd coordinates, with a wall or a corridor between two neighbouring ones
+  const Idx junctions = (side - 1) / 2;
+  const auto tile = [](Loc junction) {
+    return Loc{(Idx{2} * junction.row) + 1, (Idx{2} * junction.col) + 1};
+  };
+
+  aoc::TextGrid result{side, side, '#'};
+  const Loc start{junctions - 1, Idx{}};
+  result[tile(start)] = '.';
+  for (const auto& [junction, parent] :
+       aoc::random_spanning_tree(junctions, junctions, start, random)) {
+    const Loc a = tile(junction);
+    const Loc b = tile(parent);
+    result[a] = '.';
+    result[Loc{(a.row + b.row) / 2, (a.col + b.col) / 2}] = '.';
+  }
+
+  // A perfect maze has a single path, so knock down some walls to offer the reindeer choices
+  const Idx extent = Idx{2} * junctions;
+  for (Idx row{1}; row < extent; ++row) {
+    for (Idx col{1 + (row % 2)}; col < extent; col += 2) {
+      if (random.chance(0.1)) {
+        result[Loc{row, col}] = '.';
+      }
+    }
+  }
+
+  result[tile(start)] = 'S';
+  result[tile(Loc{Idx{}, junctions - 1})] = 'E';
+  return std::move(result).text();
+}
+
+}  // namespace day16
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day16",
+                                                 .unit = "maze side",
+                                                 .min_size = 5UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day16::generate});
+
+}  // namespace
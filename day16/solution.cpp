@@ -0,0 +1,125 @@
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "flat_hash.hpp"
+#include "grid.hpp"
+#include "search.hpp"
+
+namespace day16 {
+
+using aoc::Loc;
+
+enum class Tile : std::uint8_t {
+  wall,
+  open,
+};
+
+struct Input {
+  aoc::Grid<Tile> maze;
+  Loc start;
+  Loc finish;
+};
+
+auto snapshot_fields(const Input& input) { return std::tie(input.maze, input.start, input.finish); }
+
+auto parse_input(std::string_view content) {
+  Loc start{};
+  Loc finish{};
+  auto maze = aoc::parse_grid(content, Tile::wall, [&start, &finish](const Loc loc, const char c) {
+    if (c == 'S') {
+      start = loc;
+    }
+    if (c == 'E') {
+      finish = loc;
+    }
+    return c == '#' ? Tile::wall : Tile::open;
+  });
+  return Input{.maze = std::move(maze), .start = start, .finish = finish};
+}
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = 0, .col = 1}, {.row = -1, .col = 0}, {.row = 0, .col = -1}, {.row = 1, .col = 0}}};
+
+enum class Direction : std::uint8_t {
+  east,
+  north,
+  west,
+  south,
+};
+
+auto turn_left(Direction dir) { return static_cast<Direction>((std::to_underlying(dir) + 1) % 4); }
+
+auto turn_right(Direction dir) { return static_cast<Direction>((std::to_underlying(dir) + 3) % 4); }
+
+struct State {
+  Loc loc;
+  Direction dir;
+
+  auto operator<=>(const State&) const = default;
+};
+
+using Cost = std::uint64_t;
+
+constexpr Cost step_cost{1};
+constexpr Cost turn_cost{1000};
+
+template <typename Emit>
+auto for_each_transition(const aoc::Grid<Tile>& maze, const State& state, Emit&& emit) {
+  const auto next_tile = state.loc + moves[std::to_underlying(state.dir)];
+  if (maze[next_tile] == Tile::open) {
+    emit(State{.loc = next_tile, .dir = state.dir}, step_cost);
+  }
+  emit(State{.loc = state.loc, .dir = turn_left(state.dir)}, turn_cost);
+  emit(State{.loc = state.loc, .dir = turn_right(state.dir)}, turn_cost);
+}
+
+// Both parts come out of one search that keeps every shortest path
+struct Analysis {
+  std::optional<Cost> lowest_cost;
+  std::vector<State> best_path_states;
+};
+
+auto analyze(const Input& input) {
+  auto search = aoc::make_search<State, Cost>(
+      input.maze.cell_count() * moves.size(),
+      [&maze = input.maze](const State& state) {
+        return (maze.index(state.loc) * moves.size()) + std::to_underlying(state.dir);
+      },
+      aoc::Predecessors::all);
+  const auto lowest_cost = search.dial(
+      State{.loc = input.start, .dir = Direction::east}, turn_cost,
+      [&input](const State& state, auto&& emit) { for_each_transition(input.maze, state, emit); },
+      [&input](const State& state) { return state.loc == input.finish; });
+  return Analysis{.lowest_cost = lowest_cost, .best_path_states = search.shortest_path_states()};
+}
+
+auto solve_part1(const auto& /*input*/, const Analysis& analysis) {
+  return analysis.lowest_cost.value_or(std::numeric_limits<Cost>::max());
+}
+
+auto solve_part2(const auto& /*input*/, const Analysis& analysis) {
+  aoc::FlatSet<Loc> result;
+  for (const State& state : analysis.best_path_states) {
+    result.insert(state.loc);
+  }
+  return result.size();
+}
+
+}  // namespace day16
+
+namespace {
+
+const auto registered = aoc::register_analyzed_day(
+    "day16", [](std::string_view text) { return day16::parse_input(text); },
+    [](const auto& input) { return day16::analyze(input); },
+    [](const auto& input, const auto& analysis) { return day16::solve_part1(input, analysis); },
+    [](const auto& input, const auto& analysis) { return day16::solve_part2(input, analysis); });
+
+}  // namespace
@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day17 {
+
+using RegisterValue = std::uint64_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // The program shifts A by three bits and prints its low octal digit until A runs out, which
+  // admits a self-reproducing value of A whatever instructions that only touch B and C are padded
+  // in between. The size is the program length, so part #2 searches through about 8^size values.
+  const auto length = size - (size % 2UZ);
+  std::vector<int> program{0, 3};
+  constexpr std::array padding{1, 2, 6, 7};  // bxl, bst, bdv and cdv
+  while (program.size() + 4UZ != length) {
+    const auto opcode = random.pick(padding);
+    program.push_back(opcode);
+    // Only small literal shifts, larger ones being undefined for the 64-bit registers
+    program.push_back(opcode == 1 ? random.uniform(0, 7) : random.uniform(0, opcode == 2 ? 6 : 3));
+  }
+  program.insert(program.end(), {5, 4, 3, 0});
+
+  const auto a = random.next() >> (64UZ - std::min(63UZ, 3UZ * length));
+  std::string result = std::format("Register A: {}\nRegister B: 0\nRegister C: 0\n\nProgram: ", a);
+  for (const auto [i, value] : std::views::enumerate(program)) {
+    std::format_to(std::back_inserter(result), "{}{}", i == 0 ? "" : ",", value);
+  }
+  result.push_back('\n');
+  return result;
+}
+
+}  // namespace day17
+
+namespace {
+
+// The self-reproducing value of A needs three bits per instruction
+const auto registered = aoc::register_generator({.day = "day17",
+                                                 .unit = "program length, rounded down to even",
+                                                 .min_size = 6UZ,
+                                                 .max_size = 20UZ,
+                                                 .generate = day17::generate});
+
+}  // namespace
@@ -2,11 +2,8 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
-#include <ios>
 #include <iterator>
 #include <optional>
-#include <print>
 #include <ranges>
 #include <span>
 #include <string>
@@ -14,6 +11,12 @@
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+#include "reference.hpp"
+
+// Interpreter run on every value of A in turn, the oracle of solution.cpp
+namespace day17::reference {
+
 using namespace std::string_view_literals;
 
 enum class Register : std::uint8_t { a, b, c };
@@ -38,11 +41,9 @@ struct Input {  // NOLINT(cppcoreguidelines-pro-type-member-init)
   std::vector<Int> program;
 };
 
-auto parse_input(std::istream&& in) {
+auto parse_input(std::string_view content) {
   Input result;
 
-  const auto content =
-      std::views::istream<char>(in >> std::noskipws) | std::ranges::to<std::vector>();
   auto sections = std::views::split(content, "\n\n"sv);
   auto section_it = sections.begin();
 
@@ -232,8 +233,14 @@ class ComputerOutput {
   std::optional<Int> output_;
 };
 
+}  // namespace day17::reference
+
 template <>
-constexpr bool std::disable_sized_sentinel_for<ComputerOutput, std::default_sentinel_t> = true;
+constexpr bool
+    std::disable_sized_sentinel_for<day17::reference::ComputerOutput, std::default_sentinel_t> =
+        true;
+
+namespace day17::reference {
 
 auto solve_part2(const Input& input) {
   return *std::ranges::find_if(std::views::iota(RegisterValue{0}), [&input](const RegisterValue v) {
@@ -254,10 +261,13 @@ auto solve_part2(const Input& input) {
   });
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day17::reference
+
+namespace {
+
+const auto registered = aoc::register_reference(
+    "day17", 8UZ, [](std::string_view text) { return day17::reference::parse_input(text); },
+    [](const auto& input) { return day17::reference::solve_part1(input); },
+    [](const auto& input) { return day17::reference::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "scanner.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day17 {
+
+enum class Register : std::uint8_t { a, b, c };
+
+enum class Operator : std::uint8_t {
+  adv,
+  bxl,
+  bst,
+  jnz,
+  bxc,
+  out,
+  bdv,
+  cdv,
+};
+
+using RegisterValue = std::uint64_t;
+
+using Int = std::uint8_t;
+
+struct Input {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  std::array<RegisterValue, 3> register_values;
+  std::vector<Int> program;
+};
+
+auto snapshot_fields(const Input& input) { return std::tie(input.register_values, input.program); }
+
+constexpr auto parse_input(std::string_view content) {
+  Input result{};
+  aoc::Scanner scanner{content};
+  for (auto& value : result.register_values) {
+    value = *scanner.next<RegisterValue>();
+  }
+  while (const auto i = scanner.next<Int>()) {
+    result.program.push_back(*i);
+  }
+  return result;
+}
+
+class Computer {
+ public:
+  auto output() -> std::vector<Int>;
+  auto next_output() -> std::optional<Int>;
+
+  Computer(std::span<const RegisterValue, 3> register_values, std::span<const Int> program)
+      : register_values_{register_values[0], register_values[1], register_values[2]},
+        program_{program} {}
+
+ private:
+  auto operand_value(Operator op, Int operand) const;
+  auto combo_value(Int operand) const;
+  static auto literal_value(Int operand) { return RegisterValue{operand}; }
+
+  auto operator[](Register r) const;
+  auto operator[](Register r) -> decltype(auto);
+
+  std::array<RegisterValue, 3> register_values_;
+  std::span<const Int> program_;
+
+  using IpValue = decltype(program_)::size_type;
+  IpValue ip_{};
+};
+
+auto Computer::operator[](Register r) const { return register_values_[std::to_underlying(r)]; }
+
+auto Computer::operator[](Register r) -> decltype(auto) {
+  return register_values_[std::to_underlying(r)];
+}
+
+auto Computer::combo_value(Int operand) const {
+  assert(operand < Int{7});
+  switch (operand) {
+    case Int{0}:
+      return RegisterValue{0};
+    case Int{1}:
+      return RegisterValue{1};
+    case Int{2}:
+      return RegisterValue{2};
+    case Int{3}:
+      return RegisterValue{3};
+    case Int{4}:
+      return std::as_const(*this)[Register::a];
+    case Int{5}:
+      return std::as_const(*this)[Register::b];
+    case Int{6}:
+      return std::as_const(*this)[Register::c];
+    default:
+      std::unreachable();
+  }
+}
+
+auto Computer::operand_value(Operator op, Int operand) const {
+  switch (op) {
+    case Operator::adv:
+    case Operator::bst:
+    case Operator::out:
+    case Operator::bdv:
+    case Operator::cdv:
+      return combo_value(operand);
+    case Operator::bxl:
+    case Operator::jnz:
+    case Operator::bxc:
+      return literal_value(operand);
+  }
+  std::unreachable();
+}
+
+auto Computer::next_output() -> std::optional<Int> {
+  while (ip_ < program_.size()) {
+    assert(ip_ + IpValue{1} != program_.size());
+    assert(program_[ip_] <= Int{7});
+    const auto op = static_cast<Operator>(program_[ip_]);
+    const auto value = operand_value(op, program_[ip_ + IpValue{1}]);
+
+    switch (op) {
+      case Operator::adv:
+        (*this)[Register::a] >>= value;
+        ip_ += IpValue{2};
+        break;
+      case Operator::bxl:
+        (*this)[Register::b] ^= value;
+        ip_ += IpValue{2};
+        break;
+      case Operator::bst:
+        (*this)[Register::b] = value % RegisterValue{8};
+        ip_ += IpValue{2};
+        break;
+      case Operator::jnz:
+        if (std::as_const(*this)[Register::a] == RegisterValue{0}) {
+          ip_ += IpValue{2};
+        } else {
+          ip_ = IpValue{value};
+        }
+        break;
+      case Operator::bxc:
+        (*this)[Register::b] ^= std::as_const(*this)[Register::c];
+        ip_ += IpValue{2};
+        break;
+      case Operator::out: {
+        const Int result = value % RegisterValue{8};
+        ip_ += IpValue{2};
+        return {result};
+      }
+      case Operator::bdv:
+        (*this)[Register::b] = std::as_const(*this)[Register::a] >> value;
+        ip_ += IpValue{2};
+        break;
+      case Operator::cdv:
+        (*this)[Register::c] = std::as_const(*this)[Register::a] >> value;
+        ip_ += IpValue{2};
+        break;
+    }
+  }
+
+  return std::nullopt;
+}
+
+auto Computer::output() -> std::vector<Int> {
+  std::vector<Int> result;
+
+  for (auto maybe_output = next_output(); maybe_output.has_value(); maybe_output = next_output()) {
+    result.push_back(*maybe_output);
+  }
+
+  return result;
+}
+
+auto solve_part1(const Input& input) {
+  return std::views::join_with(
+             std::views::transform(Computer{input.register_values, input.program}.output(),
+                                   [](const Int i) { return std::to_string(i); }),
+             ',') |
+         std::ranges::to<std::string>();
+}
+
+// The programs are loops that print one value per iteration, shift A right by three bits with the
+// only `adv 3` and jump back to the start with the final `jnz 0` until A is zero
+auto is_shift_loop(std::span<const Int> program) {
+  if (program.empty() || program.size() % 2UZ != 0UZ) {
+    return false;
+  }
+  std::size_t shifts{};
+  std::size_t jumps{};
+  for (std::size_t ip{}; ip != program.size(); ip += 2UZ) {
+    const auto op = Operator(program[ip]);
+    if (op == Operator::adv) {
+      shifts += program[ip + 1UZ] == Int{3} ? 1UZ : 2UZ;  // Any other shift disqualifies
+    }
+    if (op == Operator::jnz) {
+      ++jumps;
+    }
+  }
+  return shifts == 1UZ && jumps == 1UZ && Operator(program.end()[-2]) == Operator::jnz &&
+         program.back() == Int{0};
+}
+
+// Whether A makes the program print exactly its last `length` values
+auto prints_suffix(const Input& input, RegisterValue a, std::size_t length) {
+  auto register_values = input.register_values;
+  register_values[std::to_underlying(Register::a)] = a;
+  Computer computer{register_values, input.program};
+  const auto suffix = std::span{input.program}.last(length);
+  auto it = suffix.begin();
+  for (auto output = computer.next_output(); output.has_value(); output = computer.next_output()) {
+    if (it == suffix.end() || *output != *it) {
+      return false;
+    }
+    ++it;
+  }
+  return it == suffix.end();
+}
+
+// As the next iteration runs on A without its low octal digit, a value of A printing the last
+// `length` values of the program is one printing the last `length - 1` followed by a digit. The
+// digits are tried from the most significant one in increasing order, so the first value of A
+// printing the whole program is the smallest one.
+auto smallest_quine(const Input& input, RegisterValue high_digits, std::size_t length)
+    -> std::optional<RegisterValue> {
+  for (RegisterValue digit{}; digit != RegisterValue{8}; ++digit) {
+    const auto a = (high_digits << 3U) | digit;
+    if (!prints_suffix(input, a, length)) {
+      continue;
+    }
+    if (length == input.program.size()) {
+      return a;
+    }
+    if (const auto result = smallest_quine(input, a, length + 1UZ); result.has_value()) {
+      return result;
+    }
+  }
+  return std::nullopt;
+}
+
+// Any other program is run on every value of A in turn, as the reference solver does
+auto first_quine(const Input& input) {
+  RegisterValue a{};
+  while (!prints_suffix(input, a, input.program.size())) {
+    ++a;
+  }
+  return a;
+}
+
+auto solve_part2(const Input& input) {
+  if (is_shift_loop(input.program)) {
+    if (const auto result = smallest_quine(input, RegisterValue{}, 1UZ); result.has_value()) {
+      return *result;
+    }
+  }
+  return first_quine(input);
+}
+
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_register_values = parse_input(aoc::embedded::text).register_values;
+constexpr auto embedded_program =
+    aoc::freeze<[] { return parse_input(aoc::embedded::text).program; }>();
+#endif
+
+}  // namespace day17
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day17", [](std::string_view text) { return day17::parse_input(text); },
+    [](const auto& input) { return day17::solve_part1(input); },
+    [](const auto& input) { return day17::solve_part2(input); });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse("day17", [] {
+  return std::any{day17::Input{.register_values = day17::embedded_register_values,
+                               .program = aoc::thaw(day17::embedded_program)}};
+});
+#endif
+
+}  // namespace
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day18 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+// The solver works on a fixed memory space and lets a fixed number of bytes fall in part #1
+constexpr Idx side{71};
+constexpr std::size_t first_fall{1024};
+
+auto exit_reachable(std::span<const Loc> bytes) {
+  constexpr std::array<Loc, 4> steps{
+      {{.row = -1, .col = 0}, {.row = 1, .col = 0}, {.row = 0, .col = -1}, {.row = 0, .col = 1}}};
+  aoc::TextGrid memory{side, side, '.'};
+  for (const Loc loc : bytes) {
+    memory[loc] = '#';
+  }
+  std::vector<Loc> todo{Loc{}};
+  memory[Loc{}] = 'O';
+  while (!todo.empty()) {
+    const Loc loc = todo.back();
+    todo.pop_back();
+    if (loc == Loc{side - 1, side - 1}) {
+      return true;
+    }
+    for (const Loc step : steps) {
+      if (const Loc next = loc + step; memory.contains(next) && memory[next] == '.') {
+        memory[next] = 'O';
+        todo.push_back(next);
+      }
+    }
+  }
+  return false;
+}
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::vector<Loc> bytes;
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      if (const Loc loc{row, col}; loc != Loc{} && loc != Loc{side - 1, side - 1}) {
+        bytes.push_back(loc);
+      }
+    }
+  }
+
+  // Part #2 looks for the first byte cutting the exit off, which must come after the first fall
+  std::size_t cut{};
+  do {
+    random.shuffle(bytes);
+    cut = *std::ranges::partition_point(std::views::iota(0UZ, bytes.size()), [&](std::size_t n) {
+      return exit_reachable(std::span{bytes}.first(n + 1UZ));
+    });
+  } while (cut < first_fall);
+  bytes.resize(std::max(size, cut + 1UZ));
+
+  std::string result;
+  for (const Loc loc : bytes) {
+    std::format_to(std::back_inserter(result), "{},{}\n", loc.row, loc.col);
+  }
+  return result;
+}
+
+}  // namespace day18
+
+namespace {
+
+const auto registered =
+    aoc::register_generator({.day = "day18",
+                             .unit = "bytes, raised to the first cutting one",
+                             .min_size = day18::first_fall,
+                             .max_size = std::size_t(day18::side * day18::side) - 2UZ,
+                             .generate = day18::generate});
+
+}  // namespace
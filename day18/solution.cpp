@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "counters.hpp"
+#include "day.hpp"
+#include "grid.hpp"
+#include "scanner.hpp"
+#include "search.hpp"
+#include "stream.hpp"
+#include "trace.hpp"
+
+namespace day18 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto manhattan_length(const Loc& loc) { return std::abs(loc.row) + std::abs(loc.col); }
+
+auto parse_input(std::string_view data) {
+  std::vector<Loc> result;
+  aoc::Scanner scanner{data};
+  while (const auto row = scanner.next<Idx>()) {
+    const auto col = *scanner.next<Idx>();
+    result.push_back(Loc{.row = *row, .col = col});
+  }
+  return result;
+}
+
+// Falling byte on one line, for the streaming mode
+auto parse_line(std::string_view line) -> std::optional<Loc> {
+  aoc::Scanner scanner{line};
+  const auto row = scanner.next<Idx>();
+  if (!row.has_value()) {
+    return std::nullopt;
+  }
+  return Loc{.row = *row, .col = *scanner.next<Idx>()};
+}
+
+enum class Block : std::uint8_t {
+  open,
+  corrupted,
+};
+
+class Memory {
+ public:
+  Memory(Loc lower_right, std::span<const Loc> bad_blocks)
+      : blocks_(lower_right.row + Idx{1}, lower_right.col + Idx{1}, Block::open,
+                Block::corrupted) {
+    for (const Loc& loc : bad_blocks) {
+      blocks_[loc] = Block::corrupted;
+    }
+  }
+
+  auto block_is_open(Loc loc) const { return blocks_[loc] == Block::open; }
+  auto index(Loc loc) const { return blocks_.index(loc); }
+  auto cell_count() const { return blocks_.cell_count(); }
+
+ private:
+  aoc::Grid<Block> blocks_;
+};
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = 0, .col = 1}, {.row = -1, .col = 0}, {.row = 0, .col = -1}, {.row = 1, .col = 0}}};
+
+using Cost = std::uint32_t;
+
+auto solve_astar(std::span<const Loc> bad_blocks, Idx size) -> std::optional<Cost> {
+  const aoc::trace::Span span{"solve_astar", "day18"};
+  AOC_COUNT("searches", 1);
+  const Loc exit{.row = size, .col = size};
+  const Memory memory{exit, bad_blocks};
+
+  auto search = aoc::make_search<Loc, Cost>(
+      memory.cell_count(), [&memory](const Loc& loc) { return memory.index(loc); });
+  return search.astar(
+      Loc{.row = Idx{}, .col = Idx{}},
+      [&memory](const Loc& loc, auto&& emit) {
+        for (const auto& move : moves) {
+          if (const auto target = loc + move; memory.block_is_open(target)) {
+            emit(target, Cost{1});
+          } else {
+            AOC_COUNT("candidates pruned", 1);
+          }
+        }
+      },
+      [&exit](const Loc& loc) { return Cost(manhattan_length(exit - loc)); },
+      [&exit](const Loc& loc) { return loc == exit; });
+}
+
+auto solve_part1(const auto& input) {
+  const auto result = solve_astar({input.cbegin(), std::next(input.cbegin(), 1024)}, Idx{70});
+  return result.has_value() ? *result : std::numeric_limits<Cost>::max();
+}
+
+auto solve_part2(const auto& input) {
+  const auto start_index = 1024UZ;
+  auto res = std::ranges::upper_bound(std::next(input.cbegin(), start_index), input.cend(), true,
+                                      std::greater<>{}, [&input](const auto& last) {
+                                        const std::span<const Loc> bad_blocks{input.data(),
+                                                                              std::next(&last)};
+                                        return solve_astar(bad_blocks, Idx{70}).has_value();
+                                      });
+  assert(res != input.cend());
+  return std::format("{},{}", res->row, res->col);
+}
+
+}  // namespace day18
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day18", [](std::string_view text) { return day18::parse_input(text); },
+    [](const auto& input) { return day18::solve_part1(input); },
+    [](const auto& input) { return day18::solve_part2(input); });
+
+// Both parts search on a prefix of the bytes, so they are gathered as they arrive
+const auto registered_streaming = aoc::register_streaming_day(
+    "day18", [](std::string_view line) { return day18::parse_line(line); }, std::vector<aoc::Loc>{},
+    [](auto& bytes, const auto& batch) { bytes.insert(bytes.end(), batch.begin(), batch.end()); },
+    [](const auto& bytes) { return day18::solve_part1(bytes); },
+    [](const auto& bytes) { return day18::solve_part2(bytes); });
+
+}  // namespace
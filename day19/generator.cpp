@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day19 {
+
+constexpr std::string_view colors = "wubrg";
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // No towel starts with the scarce color or shows two stripes of it in a row, so a design doing
+  // either cannot be made, whereas a design lined with towels obviously can
+  const char scarce = random.pick(colors);
+  const auto valid = [scarce](const std::string& pattern) {
+    return !pattern.starts_with(scarce) && !pattern.contains(std::string(2UZ, scarce));
+  };
+  std::vector<std::string> patterns;
+  while (patterns.size() != 447UZ) {
+    std::string pattern(random.uniform(1UZ, 8UZ), ' ');
+    for (char& color : pattern) {
+      color = random.pick(colors);
+    }
+    if (valid(pattern) && !std::ranges::contains(patterns, pattern)) {
+      patterns.push_back(std::move(pattern));
+    }
+  }
+
+  std::string result;
+  for (const auto& pattern : patterns) {
+    result.append(pattern);
+    result.append(&pattern == &patterns.back() ? "\n\n" : ", ");
+  }
+
+  for (std::size_t i{}; i != size; ++i) {
+    const auto length = random.uniform(20UZ, 60UZ);
+    std::string design;
+    while (design.size() < length) {
+      design.append(random.pick(patterns));
+    }
+    if (random.chance(0.4)) {
+      design.insert(random.uniform(0UZ, design.size()), 2UZ, scarce);
+    }
+    result.append(design);
+    result.push_back('\n');
+  }
+  return result;
+}
+
+}  // namespace day19
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day19",
+                                                 .unit = "designs",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day19::generate});
+
+}  // namespace
@@ -1,18 +1,23 @@
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <ios>
 #include <iterator>
-#include <map>
 #include <optional>
-#include <print>
 #include <ranges>
 #include <span>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "counters.hpp"
+#include "day.hpp"
+#include "flat_hash.hpp"
+#include "parallel.hpp"
+
+namespace day19 {
+
 using namespace std::string_view_literals;
 
 enum class Color : std::uint8_t {
@@ -74,9 +79,9 @@ struct Input {
   std::vector<Design> designs;
 };
 
-auto parse_input(std::istream&& in) {
-  const auto content =
-      std::views::istream<char>(in >> std::noskipws) | std::ranges::to<std::vector>();
+auto snapshot_fields(const Input& input) { return std::tie(input.patterns, input.designs); }
+
+auto parse_input(std::string_view content) {
   auto sections = std::views::split(content, "\n\n"sv);
   auto section_it = std::ranges::begin(sections);
 
@@ -105,16 +110,22 @@ auto parse_input(std::istream&& in) {
 }
 
 auto possible_arrangements(const std::span<const Pattern> patterns, const Design& design) {
-  std::map<Design::const_iterator, std::uint64_t> prefixes{{design.begin(), std::uint64_t(1)}};
+  AOC_COUNT("designs", 1);
+  aoc::FlatMap<Design::const_iterator, std::uint64_t> prefixes;
+  prefixes.try_emplace(design.begin(), std::uint64_t(1));
+  decltype(prefixes) next_prefixes;
 
   for (auto it = design.begin(); it != design.end(); ++it) {
-    decltype(prefixes) next_prefixes;
+    next_prefixes.clear();
 
+    AOC_COUNT_MAX("live prefixes", prefixes.size());
     for (const auto& [prefix_begin, count] : prefixes) {
       const std::span<const Color> candidate{prefix_begin, std::next(it)};
+      AOC_COUNT("pattern matches", patterns.size());
       for (const auto& pattern : patterns) {
         const auto [it_p, it_c] = std::ranges::mismatch(pattern, candidate);
         if (it_c == candidate.end()) {
+          AOC_COUNT("map lookups", 1);
           if (it_p == pattern.end()) {
             next_prefixes[std::next(it)] += count;
           } else {
@@ -125,10 +136,11 @@ auto possible_arrangements(const std::span<const Pattern> patterns, const Design
     }
 
     if (next_prefixes.empty()) {
+      AOC_COUNT("designs pruned", 1);
       return std::uint64_t{};
     }
 
-    prefixes = next_prefixes;
+    std::swap(prefixes, next_prefixes);
   }
 
   const auto result = prefixes.find(design.end());
@@ -140,22 +152,24 @@ auto is_design_possible(const std::span<const Pattern> patterns, const Design& d
 }
 
 auto solve_part1(const auto& input) {
-  return std::ranges::count_if(input.designs, [&](const Design& design) {
-    return is_design_possible(input.patterns, design);
+  return aoc::parallel_reduce(input.designs, 1UZ, 0UZ, [&](const Design& design) {
+    return is_design_possible(input.patterns, design) ? 1UZ : 0UZ;
   });
 }
 
 auto solve_part2(const auto& input) {
-  return std::ranges::fold_left(input.designs, std::uint64_t{},
-                                [&](const auto acc, const Design& design) {
-                                  return acc + possible_arrangements(input.patterns, design);
-                                });
+  return aoc::parallel_reduce(input.designs, 1UZ, std::uint64_t{}, [&](const Design& design) {
+    return possible_arrangements(input.patterns, design);
+  });
 }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day19
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day19", [](std::string_view text) { return day19::parse_input(text); },
+    [](const auto& input) { return day19::solve_part1(input); },
+    [](const auto& input) { return day19::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day20 {
+
+using aoc::Idx;
+using aoc::Loc;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  const auto side = Idx(size);
+  // Junctions sit on odd coordinates, with a wall or a track between two neighbouring ones
+  const Idx junctions = (side - 1) / 2;
+  const auto tile = [](Loc junction) {
+    return Loc{(Idx{2} * junction.row) + 1, (Idx{2} * junction.col) + 1};
+  };
+  const auto index = [junctions](Loc junction) {
+    return (std::size_t(junction.row) * std::size_t(junctions)) + std::size_t(junction.col);
+  };
+
+  // The race track is the branch of a random maze leading to its deepest junction. Any two
+  // junctions on it are either consecutive or separated by a wall, so it never forks.
+  const Loc start{random.uniform(Idx{}, junctions - 1), random.uniform(Idx{}, junctions - 1)};
+  std::vector<Loc> parents(std::size_t(junctions) * std::size_t(junctions), start);
+  std::vector<std::size_t> depths(parents.size());
+  Loc finish = start;
+  for (const auto& [junction, parent] :
+       aoc::random_spanning_tree(junctions, junctions, start, random)) {
+    parents[index(junction)] = parent;
+    depths[index(junction)] = depths[index(parent)] + 1UZ;
+    if (depths[index(junction)] > depths[index(finish)]) {
+      finish = junction;
+    }
+  }
+
+  aoc::TextGrid result{side, side, '#'};
+  for (Loc junction = finish; junction != start; junction = parents[index(junction)]) {
+    const Loc a = tile(junction);
+    const Loc b = tile(parents[index(junction)]);
+    result[a] = '.';
+    result[Loc{(a.row + b.row) / 2, (a.col + b.col) / 2}] = '.';
+  }
+  result[tile(start)] = 'S';
+  result[tile(finish)] = 'E';
+  return std::move(result).text();
+}
+
+}  // namespace day20
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day20",
+                                                 .unit = "racetrack side",
+                                                 .min_size = 5UZ,
+                                                 .max_size = aoc::max_grid_side,
+                                                 .generate = day20::generate});
+
+}  // namespace
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "flat_hash.hpp"
+#include "grid.hpp"
+#include "search.hpp"
+
+namespace day20 {
+
+using aoc::Loc;
+
+enum class Tile : std::uint8_t {
+  wall,
+  open,
+};
+
+struct Input {
+  aoc::Grid<Tile> maze;
+  Loc start;
+  Loc finish;
+};
+
+auto snapshot_fields(const Input& input) { return std::tie(input.maze, input.start, input.finish); }
+
+auto parse_input(std::string_view content) {
+  Loc start{};
+  Loc finish{};
+  auto maze = aoc::parse_grid(content, Tile::wall, [&start, &finish](const Loc loc, const char c) {
+    if (c == 'S') {
+      start = loc;
+    }
+    if (c == 'E') {
+      finish = loc;
+    }
+    return c == '#' ? Tile::wall : Tile::open;
+  });
+  return Input{.maze = std::move(maze), .start = start, .finish = finish};
+}
+
+constexpr std::array<Loc, 4> moves{
+    {{.row = 0, .col = 1}, {.row = -1, .col = 0}, {.row = 0, .col = -1}, {.row = 1, .col = 0}}};
+
+auto open_tile_count(const Input& input) {
+  return std::size_t(std::ranges::count(input.maze.values(), Tile::open));
+}
+
+using Cost = std::int32_t;
+
+// Breadth-first search along the track, remembering the way back from the finish
+auto search_track(const Input& input) {
+  auto search = aoc::make_search<Loc, Cost>(
+      input.maze.cell_count(), [&maze = input.maze](const Loc& loc) { return maze.index(loc); },
+      aoc::Predecessors::one);
+  [[maybe_unused]] const auto length = search.bfs(
+      input.start,
+      [&maze = input.maze](const Loc& loc, auto&& emit) {
+        for (const Loc m : moves) {
+          if (maze[loc + m] == Tile::open) {
+            emit(loc + m, Cost{1});
+          }
+        }
+      },
+      [&input](const Loc& loc) { return loc == input.finish; });
+  assert(length.has_value());
+  return search;
+}
+
+struct Cheat {
+  Loc wall;
+  Loc exit;
+
+  auto operator<=>(const Cheat&) const = default;
+};
+
+struct CheatHash {
+  auto operator()(const Cheat& cheat) const {
+    return aoc::hash_combine(aoc::Hash{}(cheat.wall), cheat.exit);
+  }
+};
+
+auto compute_cheat_gains(const Input& input) {
+  const auto search = search_track(input);
+  const auto fair_path = search.path(input.finish);
+  assert(fair_path.size() == open_tile_count(input));
+
+  aoc::FlatMap<Cheat, Cost, CheatHash> result;
+
+  for (const auto [entry_cost, entry] : std::views::enumerate(fair_path)) {
+    for (const Loc m : moves) {
+      const Loc wall = entry + m;
+      if (input.maze[wall] == Tile::wall) {
+        const Loc exit = wall + m;
+        const auto exit_cost = input.maze.contains(exit) ? search.cost(exit) : std::nullopt;
+        if (exit_cost.has_value()) {
+          const Cost gain = *exit_cost - (Cost(entry_cost) + Cost{2});
+          if (gain > Cost{}) {
+            result.emplace(Cheat{.wall = wall, .exit = exit}, gain);
+          }
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+auto solve_part1(const auto& /*input*/, const auto& cheat_gains) {
+  constexpr Cost bound{100};
+
+  return std::ranges::count_if(std::views::values(cheat_gains),
+                               [](const Cost gain) { return gain >= bound; });
+}
+
+auto solve_part2(const auto& input, const auto& cheat_gains) { return 0; }
+
+}  // namespace day20
+
+namespace {
+
+const auto registered = aoc::register_analyzed_day(
+    "day20", [](std::string_view text) { return day20::parse_input(text); },
+    [](const auto& input) { return day20::compute_cheat_gains(input); },
+    [](const auto& input, const auto& analysis) { return day20::solve_part1(input, analysis); },
+    [](const auto& input, const auto& analysis) { return day20::solve_part2(input, analysis); });
+
+}  // namespace
@@ -0,0 +1,32 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+
+#include "generator.hpp"
+
+namespace day22 {
+
+using Int = std::uint64_t;
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  std::string result;
+  for (std::size_t i{}; i != size; ++i) {
+    // Secret numbers are pruned modulo 2^24
+    std::format_to(std::back_inserter(result), "{}\n", random.uniform(Int{1}, Int{16777215}));
+  }
+  return result;
+}
+
+}  // namespace day22
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day22",
+                                                 .unit = "buyers",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day22::generate});
+
+}  // namespace
@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "day.hpp"
+#include "parallel.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day22 {
+
+using Int = std::uint64_t;
+
+constexpr auto parse_input(std::string_view data) {
+  std::vector<Int> result;
+  aoc::Scanner scanner{data};
+  while (const auto secret = scanner.next<Int>()) {
+    result.push_back(*secret);
+  }
+  return result;
+}
+
+// Initial secret of the buyer on one line, for the streaming mode
+auto parse_line(std::string_view line) -> std::optional<Int> {
+  return aoc::Scanner{line}.next<Int>();
+}
+
+auto mix(const Int a, const Int b) { return a ^ b; }
+
+auto prune(const Int a) { return a % Int{16777216}; }
+
+auto next_secret_number(const Int a) {
+  const Int step1 = prune(mix(a, a * Int{64}));
+  const Int step2 = prune(mix(step1, step1 / Int{32}));
+  const Int step3 = prune(mix(step2, step2 * Int{2048}));
+  return step3;
+}
+
+// The buyers are independent, and each task steps its own ones together so that the loop over
+// them stays vectorized
+auto sum_secrets(std::span<Int> secrets) {
+  aoc::parallel_for(secrets.size(), 256UZ, [&](std::size_t begin, std::size_t end) {
+    const std::span<Int> buyers{std::next(secrets.begin(), std::ptrdiff_t(begin)),
+                                std::next(secrets.begin(), std::ptrdiff_t(end))};
+    for (auto _ : std::views::iota(0, 2000)) {
+      for (auto& s : buyers) {
+        s = next_secret_number(s);
+      }
+    }
+  });
+  return std::reduce(std::ranges::begin(secrets), std::ranges::end(secrets), Int{});
+}
+
+auto solve_part1(const auto& input) {
+  auto secrets = input;
+  return sum_secrets(secrets);
+}
+
+// For a batch of the streaming mode, stepped in `buffer`, which is reused from one batch to the
+// next
+auto solve_part1(std::span<const Int> secrets, std::vector<Int>& buffer) {
+  buffer.assign(secrets.begin(), secrets.end());
+  return sum_secrets(buffer);
+}
+
+auto solve_part2(const auto& input) { return 0; }
+
+struct StreamState {
+  Int sum{};
+  std::vector<Int> buffer;
+};
+
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_secrets = aoc::freeze<[] { return parse_input(aoc::embedded::text); }>();
+#endif
+
+}  // namespace day22
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day22", [](std::string_view text) { return day22::parse_input(text); },
+    [](const auto& input) { return day22::solve_part1(input); },
+    [](const auto& input) { return day22::solve_part2(input); });
+
+// The buyers are independent, so each batch is summed and dropped as it arrives
+const auto registered_streaming = aoc::register_streaming_day(
+    "day22", [](std::string_view line) { return day22::parse_line(line); }, day22::StreamState{},
+    [](auto& state, const auto& secrets) {
+      state.sum += day22::solve_part1(secrets, state.buffer);
+    },
+    [](const auto& state) { return state.sum; }, [](const auto& /*state*/) { return 0; });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse(
+    "day22", [] { return std::any{aoc::thaw(day22::embedded_secrets)}; });
+#endif
+
+}  // namespace
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day23 {
+
+// Distinct lowercase names, two letters long like the real ones as long as there are enough
+auto computer_names(std::size_t count, aoc::Random& random) {
+  std::size_t length{2};
+  std::size_t capacity{26UZ * 26UZ};
+  while (capacity < count) {
+    ++length;
+    capacity *= 26UZ;
+  }
+  std::vector<std::uint32_t> codes(capacity);
+  std::iota(codes.begin(), codes.end(), std::uint32_t{});
+  random.shuffle(codes);
+
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (auto code : std::span{codes}.first(count)) {
+    std::string& name = result.emplace_back(length, 'a');
+    for (char& letter : name) {
+      letter = char('a' + (code % 26U));
+      code /= 26U;
+    }
+  }
+  return result;
+}
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // A LAN party of the first `party_size` computers, and sparse links between the others drawn
+  // from a graph coloured with `party_size - 2` colours, which has no larger clique than that. Each
+  // outsider also links to at most one member of the party, so that the party is the only largest
+  // clique: one spanning an outsider holds at most one member, plus one computer per colour.
+  constexpr std::size_t party_size{13};
+  constexpr std::size_t color_count{party_size - 2UZ};
+  const auto names = computer_names(size, random);
+
+  std::vector<std::pair<std::size_t, std::size_t>> links;
+  for (std::size_t i{}; i != party_size; ++i) {
+    for (std::size_t j{i + 1UZ}; j != party_size; ++j) {
+      links.emplace_back(i, j);
+    }
+  }
+  for (std::size_t i{party_size}; i != size; ++i) {
+    if (random.chance(0.5)) {
+      links.emplace_back(random.uniform(0UZ, party_size - 1UZ), i);
+    }
+  }
+  const auto color = [](std::size_t computer) { return computer % color_count; };
+  const auto outsider_link_count = (size - party_size) * 6UZ;
+  for (std::size_t i{}; i != outsider_link_count; ++i) {
+    const auto a = random.uniform(party_size, size - 1UZ);
+    const auto b = random.uniform(party_size, size - 1UZ);
+    if (color(a) != color(b)) {
+      links.emplace_back(std::min(a, b), std::max(a, b));
+    }
+  }
+  std::ranges::sort(links);
+  const auto duplicates = std::ranges::unique(links);
+  links.erase(duplicates.begin(), duplicates.end());
+  random.shuffle(links);
+
+  std::string result;
+  for (const auto& [a, b] : links) {
+    const bool flip = random.chance(0.5);
+    result.append(names[flip ? b : a]);
+    result.push_back('-');
+    result.append(names[flip ? a : b]);
+    result.push_back('\n');
+  }
+  return result;
+}
+
+}  // namespace day23
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day23",
+                                                 .unit = "computers",
+                                                 .min_size = 16UZ,
+                                                 .max_size = 26UZ * 26UZ * 26UZ * 26UZ * 26UZ,
+                                                 .generate = day23::generate});
+
+}  // namespace
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arena.hpp"
+#include "day.hpp"
+#include "scanner.hpp"
+#include "stream.hpp"
+#include "trace.hpp"
+
+namespace day23 {
+
+using Computer = std::string;
+using Link = std::array<Computer, 2>;
+
+// Link on one line, nothing for a blank line
+auto parse_line(std::string_view line) -> std::optional<Link> {
+  const auto dash = line.find('-');
+  if (dash == std::string_view::npos) {
+    return std::nullopt;
+  }
+  return Link{Computer{line.substr(0UZ, dash)}, Computer{line.substr(dash + 1UZ)}};
+}
+
+auto parse_input(std::string_view data) {
+  std::vector<Link> result;
+  aoc::Scanner lines{data};
+  while (!lines.done()) {
+    if (auto link = parse_line(lines.line()); link.has_value()) {
+      result.push_back(std::move(*link));
+    }
+  }
+  return result;
+}
+
+using Neighborhoods = std::multimap<Computer, Computer>;
+
+auto compute_neighborhoods(const std::span<const Link> links) {
+  Neighborhoods result;
+
+  for (const Link& link : links) {
+    const auto it_pair = result.equal_range(link[0]);
+    if (!std::ranges::contains(it_pair.first, it_pair.second, link[1],
+                               [](const auto& p) { return p.second; })) {
+      result.emplace_hint(it_pair.second, link[0], link[1]);
+      result.emplace(link[1], link[0]);
+    }
+  }
+
+  return result;
+}
+
+auto get_neighbors(const Neighborhoods& neighborhoods, const Computer& computer) {
+  const auto n_it = neighborhoods.equal_range(computer);
+  return std::views::values(std::ranges::subrange(n_it.first, n_it.second));
+}
+
+using Party = std::pmr::vector<Computer>;  // Sorted
+using Parties = std::pmr::set<Party>;
+
+// The parties live in `resource`, while the candidate sets of each party use `scratch`
+auto compute_larger_parties(const Neighborhoods& neighborhoods,
+                            const std::ranges::range auto& parties,
+                            std::pmr::memory_resource& resource, aoc::Arena& scratch) {
+  const aoc::trace::Span span{"compute_larger_parties", "day23"};
+  Parties result{&resource};
+
+  for (const Party& party : parties) {
+    scratch.reset();
+    auto candidates = get_neighbors(neighborhoods, party.front()) |
+                      std::views::filter([&party](const auto& candidate) {
+                        return !std::ranges::binary_search(party, candidate);
+                      }) |
+                      std::ranges::to<std::pmr::set<Computer>>(&scratch);
+    for (const Computer& other_computer : std::views::drop(party, 1)) {
+      auto other_candidates = get_neighbors(neighborhoods, other_computer) |
+                              std::ranges::to<std::pmr::set<Computer>>(&scratch);
+      decltype(candidates) new_candidates{&scratch};
+      std::ranges::set_intersection(candidates, other_candidates,
+                                    std::inserter(new_candidates, new_candidates.begin()));
+      candidates = std::move(new_candidates);
+    }
+    for (const Computer& laureate : candidates) {
+      Party larger_party{&resource};
+      larger_party.reserve(party.size() + 1UZ);
+
+      const auto it = std::ranges::lower_bound(party, laureate);
+      larger_party.assign(party.begin(), it);
+      larger_party.push_back(laureate);
+      larger_party.insert(larger_party.end(), it, party.end());
+
+      result.insert(std::move(larger_party));
+    }
+  }
+
+  return result;
+}
+
+auto compute_pairs(const Neighborhoods& neighborhoods, std::pmr::memory_resource& resource) {
+  Parties result{&resource};
+
+  auto computers =
+      std::views::keys(neighborhoods) | std::views::chunk_by(std::equal_to<>{}) |
+      std::views::transform([](const auto& chunk) { return *std::ranges::begin(chunk); });
+
+  for (const Computer& computer : computers) {
+    auto neighbors = get_neighbors(neighborhoods, computer);
+    for (const Computer& neighbor : neighbors) {
+      Party pair{{computer, neighbor}, &resource};
+      if (pair[0] > pair[1]) {
+        std::swap(pair[0], pair[1]);
+      }
+      result.insert(std::move(pair));
+    }
+  }
+
+  return result;
+}
+
+// The links as a graph and its 2-cliques, the start of both parts. They outlive the solvers, so
+// they use the default memory resource rather than an arena.
+struct Analysis {
+  Neighborhoods neighborhoods;
+  Parties pairs;
+};
+
+auto analyze(const std::span<const Link> links) {
+  auto neighborhoods = compute_neighborhoods(links);
+  auto pairs = compute_pairs(neighborhoods, *std::pmr::get_default_resource());
+  return Analysis{.neighborhoods = std::move(neighborhoods), .pairs = std::move(pairs)};
+}
+
+auto solve_part1(const auto& /*input*/, const Analysis& analysis) {
+  auto& arena = aoc::thread_arena(0UZ);
+  auto& scratch = aoc::thread_arena(1UZ);
+  const aoc::ArenaUsage usage{&arena, &scratch};
+  arena.reset();
+  const auto triplets =
+      compute_larger_parties(analysis.neighborhoods, analysis.pairs, arena, scratch);
+  return std::ranges::count_if(triplets, [](const auto& triplet) {
+    return std::ranges::any_of(triplet,
+                               [](const Computer& member) { return member.starts_with('t'); });
+  });
+}
+
+auto solve_part2(const auto& /*input*/, const Analysis& analysis) {
+  // Each level is built from the previous one only, so two arenas take turns holding them
+  const std::array arenas{&aoc::thread_arena(0UZ), &aoc::thread_arena(1UZ)};
+  auto& scratch = aoc::thread_arena(2UZ);
+  const aoc::ArenaUsage usage{arenas[0], arenas[1], &scratch};
+  std::optional<Parties> parties;
+  const Parties* level = &analysis.pairs;
+  for (auto depth = 0UZ; level->size() > 1UZ; ++depth) {
+    auto& arena = *arenas[depth % 2UZ];
+    arena.reset();
+    parties.emplace(compute_larger_parties(analysis.neighborhoods, *level, arena, scratch));
+    level = &*parties;
+  }
+
+  assert(level->size() == 1UZ);
+  return std::views::join_with(*level->begin(), ',') | std::ranges::to<std::string>();
+}
+
+}  // namespace day23
+
+namespace {
+
+const auto registered = aoc::register_analyzed_day(
+    "day23", [](std::string_view text) { return day23::parse_input(text); },
+    [](const auto& input) { return day23::analyze(input); },
+    [](const auto& input, const auto& analysis) { return day23::solve_part1(input, analysis); },
+    [](const auto& input, const auto& analysis) { return day23::solve_part2(input, analysis); });
+
+// The graph needs every link, so they are gathered as they arrive
+const auto registered_streaming = aoc::register_streaming_analyzed_day(
+    "day23", [](std::string_view line) { return day23::parse_line(line); },
+    std::vector<day23::Link>{},
+    [](auto& links, const auto& batch) { links.insert(links.end(), batch.begin(), batch.end()); },
+    [](const auto& links) { return day23::analyze(links); },
+    [](const auto& links, const auto& analysis) { return day23::solve_part1(links, analysis); },
+    [](const auto& links, const auto& analysis) { return day23::solve_part2(links, analysis); });
+
+}  // namespace
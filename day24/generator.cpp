@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace day24 {
+
+struct GateLine {
+  std::string left;
+  std::string_view op;
+  std::string right;
+  std::string output;
+};
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // A ripple-carry adder of two `size`-bit numbers, whose internal wires get random names
+  std::set<std::string> used_names;
+  const auto fresh_name = [&] {
+    constexpr std::string_view letters = "abcdefghijklmnopqrstuvw";  // Not x, y or z
+    while (true) {
+      std::string name(3UZ, ' ');
+      for (char& letter : name) {
+        letter = random.pick(letters);
+      }
+      if (used_names.insert(name).second) {
+        return name;
+      }
+    }
+  };
+  const auto wire = [](char prefix, std::size_t bit) {
+    return std::format("{}{:02}", prefix, bit);
+  };
+
+  std::vector<GateLine> gates;
+  const auto add_gate = [&](std::string left, std::string_view op, std::string right,
+                            std::string output) {
+    if (random.chance(0.5)) {
+      std::swap(left, right);
+    }
+    gates.push_back(GateLine{std::move(left), op, std::move(right), std::move(output)});
+  };
+
+  std::string carry;
+  for (std::size_t bit{}; bit != size; ++bit) {
+    const auto x = wire('x', bit);
+    const auto y = wire('y', bit);
+    const auto z = wire('z', bit);
+    if (bit == 0UZ) {
+      add_gate(x, "XOR", y, z);
+      carry = size == 1UZ ? wire('z', 1UZ) : fresh_name();
+      add_gate(x, "AND", y, carry);
+      continue;
+    }
+    const auto sum = fresh_name();
+    const auto direct_carry = fresh_name();
+    const auto chained_carry = fresh_name();
+    add_gate(x, "XOR", y, sum);
+    add_gate(x, "AND", y, direct_carry);
+    add_gate(sum, "XOR", carry, z);
+    add_gate(sum, "AND", carry, chained_carry);
+    carry = bit + 1UZ == size ? wire('z', size) : fresh_name();
+    add_gate(direct_carry, "OR", chained_carry, carry);
+  }
+  random.shuffle(gates);
+
+  std::string result;
+  for (const char prefix : {'x', 'y'}) {
+    for (std::size_t bit{}; bit != size; ++bit) {
+      std::format_to(std::back_inserter(result), "{}: {}\n", wire(prefix, bit),
+                     random.uniform(0, 1));
+    }
+  }
+  result.push_back('\n');
+  for (const auto& gate : gates) {
+    std::format_to(std::back_inserter(result), "{} {} {} -> {}\n", gate.left, gate.op, gate.right,
+                   gate.output);
+  }
+  return result;
+}
+
+}  // namespace day24
+
+namespace {
+
+// The output bits are summed up in 64 bits, the carry out included
+const auto registered = aoc::register_generator({.day = "day24",
+                                                 .unit = "adder bits",
+                                                 .min_size = 1UZ,
+                                                 .max_size = 63UZ,
+                                                 .generate = day24::generate});
+
+}  // namespace
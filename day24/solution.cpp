@@ -2,18 +2,23 @@
 #include <array>
 #include <cassert>
 #include <charconv>
-#include <fstream>
-#include <ios>
-#include <istream>
-#include <map>
-#include <print>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "day.hpp"
+#include "flat_hash.hpp"
+#include "snapshot.hpp"
+
+namespace day24 {
+
 using namespace std::string_view_literals;
 
 using Wire = std::string;
@@ -23,10 +28,14 @@ struct WireStatus {
   bool value;
 };
 
+auto snapshot_fields(const WireStatus& status) { return std::tie(status.wire, status.value); }
+
 using Op = bool (*)(bool, bool);
 
 auto apply(const Op& op, const bool left, const bool right) { return (*op)(left, right); };
 
+constexpr std::array op_names{"AND"sv, "OR"sv, "XOR"sv};
+
 auto parse_op(std::string_view str) -> Op {
   if (str == "AND"sv) {
     return [](bool left, bool right) { return left && right; };
@@ -51,10 +60,9 @@ struct Input {
   std::vector<Gate> gates;
 };
 
-auto parse_input(std::istream&& in) {
-  const auto content =
-      std::views::istream<char>(in >> std::noskipws) | std::ranges::to<std::vector>();
+auto snapshot_fields(const Input& input) { return std::tie(input.wire_statuses, input.gates); }
 
+auto parse_input(std::string_view content) {
   auto sections = std::views::split(content, "\n\n"sv);
   auto section_it = std::ranges::begin(sections);
 
@@ -95,11 +103,11 @@ auto parse_input(std::istream&& in) {
 }
 
 auto solve_part1(const auto& input) {
-  auto values = std::views::transform(input.wire_statuses,
-                                      [](const WireStatus& s) {
-                                        return std::pair<const Wire, bool>(s.wire, s.value);
-                                      }) |
-                std::ranges::to<std::map>();
+  aoc::FlatMap<Wire, bool> values;
+  values.reserve(input.wire_statuses.size() + input.gates.size());
+  for (const auto& [wire, value] : input.wire_statuses) {
+    values.try_emplace(wire, value);
+  }
 
   auto gates = input.gates;
   for (;;) {
@@ -140,10 +148,37 @@ auto solve_part1(const auto& input) {
 
 auto solve_part2(const auto& input) { return 0; }
 
-auto main() -> int {
-  const auto input = parse_input(std::ifstream{"input.txt"});
-  const auto answer1 = solve_part1(input);
-  std::println("The answer to part #1 is {}", answer1);
-  const auto answer2 = solve_part2(input);
-  std::println("The answer to part #2 is {}", answer2);
-}
+}  // namespace day24
+
+// Operators are stored by name, as function pointers only hold within one process
+template <>
+struct aoc::Snapshot<day24::Gate> {
+  static auto save(SnapshotWriter& writer, const day24::Gate& gate) {
+    Snapshot<decltype(gate.inputs)>::save(writer, gate.inputs);
+    const auto op = std::ranges::find(day24::op_names, gate.op, day24::parse_op);
+    assert(op != day24::op_names.end());
+    writer.write(std::uint8_t(std::distance(day24::op_names.begin(), op)));
+    Snapshot<day24::Wire>::save(writer, gate.output);
+  }
+
+  static auto load(SnapshotReader& reader) -> day24::Gate {
+    auto inputs = Snapshot<decltype(day24::Gate::inputs)>::load(reader);
+    const auto op = std::size_t(reader.read<std::uint8_t>());
+    if (op >= day24::op_names.size()) {
+      reader.fail();
+    }
+    auto output = Snapshot<day24::Wire>::load(reader);
+    return day24::Gate{.inputs = std::move(inputs),
+                       .op = reader.ok() ? day24::parse_op(day24::op_names[op]) : nullptr,
+                       .output = std::move(output)};
+  }
+};
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day24", [](std::string_view text) { return day24::parse_input(text); },
+    [](const auto& input) { return day24::solve_part1(input); },
+    [](const auto& input) { return day24::solve_part2(input); });
+
+}  // namespace
@@ -0,0 +1,42 @@
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "generator.hpp"
+
+namespace day25 {
+
+auto generate(std::size_t size, aoc::Random& random) -> std::string {
+  // Locks hang pins from the top row, keys raise them from the bottom one, five columns each
+  std::string result;
+  for (std::size_t i{}; i != size; ++i) {
+    const bool lock = random.chance(0.5);
+    std::array<int, 5> heights{};
+    for (auto& height : heights) {
+      height = random.uniform(0, 5);
+    }
+    if (i != 0UZ) {
+      result.push_back('\n');
+    }
+    for (int row{}; row != 7; ++row) {
+      for (const int height : heights) {
+        const bool filled = lock ? row <= height : 6 - row <= height;
+        result.push_back(filled ? '#' : '.');
+      }
+      result.push_back('\n');
+    }
+  }
+  return result;
+}
+
+}  // namespace day25
+
+namespace {
+
+const auto registered = aoc::register_generator({.day = "day25",
+                                                 .unit = "schematics",
+                                                 .min_size = 1UZ,
+                                                 .max_size = aoc::no_size_limit,
+                                                 .generate = day25::generate});
+
+}  // namespace
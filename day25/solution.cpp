@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "day.hpp"
+#include "parallel.hpp"
+#include "scanner.hpp"
+
+#if defined(AOC_EMBEDDED_INPUT)
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+#endif
+
+namespace day25 {
+
+using Height = std::uint8_t;
+
+using Profile = std::array<Height, 5>;
+
+struct Input {
+  std::vector<Profile> locks;
+  std::vector<Profile> keys;
+};
+
+auto snapshot_fields(const Input& input) { return std::tie(input.locks, input.keys); }
+
+// Schemes of seven rows, the top one full for the locks and empty for the keys, the five in the
+// middle giving the heights
+constexpr auto parse_input(std::string_view content) {
+  Input result;
+  aoc::Scanner scanner{content};
+  while (!scanner.done()) {
+    const auto top = scanner.line();
+    if (top.empty()) {
+      continue;
+    }
+    Profile profile{};
+    for (auto row = 0; row != 5; ++row) {
+      for (auto&& [height, cell] : std::views::zip(profile, scanner.line())) {
+        if (cell == '#') {
+          ++height;
+        }
+      }
+    }
+    scanner.line();
+    (top.front() == '#' ? result.locks : result.keys).push_back(profile);
+  }
+  return result;
+}
+
+auto solve_part1(const auto& input) {
+  return aoc::parallel_reduce(input.locks, 16UZ, 0UZ, [&](const Profile& lock) {
+    return std::size_t(std::ranges::count_if(input.keys, [&](const Profile& key) {
+      return std::ranges::all_of(std::views::zip(lock, key), [](const auto& p) {
+        return std::get<0>(p) + std::get<1>(p) <= Height(5);
+      });
+    }));
+  });
+}
+
+#if defined(AOC_EMBEDDED_INPUT)
+constexpr auto embedded_locks =
+    aoc::freeze<[] { return parse_input(aoc::embedded::text).locks; }>();
+constexpr auto embedded_keys = aoc::freeze<[] { return parse_input(aoc::embedded::text).keys; }>();
+#endif
+
+}  // namespace day25
+
+namespace {
+
+const auto registered = aoc::register_day(
+    "day25", [](std::string_view text) { return day25::parse_input(text); },
+    [](const auto& input) { return day25::solve_part1(input); });
+
+#if defined(AOC_EMBEDDED_INPUT)
+const auto embedded = aoc::register_embedded_parse("day25", [] {
+  return std::any{day25::Input{.locks = aoc::thaw(day25::embedded_locks),
+                               .keys = aoc::thaw(day25::embedded_keys)}};
+});
+#endif
+
+}  // namespace
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "day.hpp"
+#include "embedded.hpp"
+#include "input.hpp"
+#include "option_value.hpp"
+#include "parallel.hpp"
+#include "result_cache.hpp"
+#include "stream.hpp"
+#include "thread_pool.hpp"
+#include "trace.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+struct Options {
+  std::size_t thread_count{std::max(std::thread::hardware_concurrency(), 1U)};
+  bool snapshot{};
+  bool use_cache{};
+  bool recompute{};
+  bool stream{};
+  std::optional<std::string> trace_path;
+  std::vector<std::string_view> days;
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    if (arg == "--threads"sv) {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      const auto count = aoc::option_value<std::size_t>(arg, *++it);
+      if (!count.has_value()) {
+        return std::nullopt;
+      }
+      result.thread_count = std::max(*count, 1UZ);
+    } else if (arg == "--trace"sv) {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      result.trace_path = std::string{*++it};
+    } else if (arg == "--snapshot"sv) {
+      result.snapshot = true;
+    } else if (arg == "--cache"sv) {
+      result.use_cache = true;
+    } else if (arg == "--recompute"sv) {
+      result.use_cache = result.recompute = true;
+    } else if (arg == "--stream"sv) {
+      result.stream = true;
+    } else if (arg.starts_with("--"sv)) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      result.days.push_back(arg);
+    }
+  }
+  return result;
+}
+
+auto thread_cpu_time() {
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return double(ts.tv_sec) + (double(ts.tv_nsec) * 1e-9);
+}
+
+struct Outcome {
+  std::optional<aoc::Answers> answers;
+  bool cached{};
+  double start{};  // Seconds since the beginning of the run
+  double wall{};
+  double cpu{};
+};
+
+auto run_day(const aoc::Day& day, const Options& options,
+             const std::optional<aoc::ResultCache>& cache, const Clock::time_point origin) {
+  const aoc::trace::Span span{day.name(), "day"};
+  Outcome result;
+  const auto start = Clock::now();
+  // The parallel loops of the day also run on the threads of the scheduler
+  const auto cpu_start = thread_cpu_time() + aoc::assisted_cpu_seconds();
+  result.start = Seconds{start - origin}.count();
+
+  const auto path = std::format("{}/input.txt", day.name());
+  // The streaming solver reads the file itself, bypassing the cache and the snapshot
+  if (const auto* streaming = options.stream ? aoc::find_streaming_day(day.name()) : nullptr;
+      streaming != nullptr) {
+    result.answers = streaming->solve(path, aoc::StreamOptions{});
+  } else {
+    // An input compiled in with AOC_EMBED_INPUTS stands for input.txt
+    const auto embedded_text = aoc::embedded_text(day.name());
+    const auto file = cache.has_value() && !embedded_text.has_value() ? aoc::MappedFile::open(path)
+                                                                      : std::nullopt;
+    const auto text = file.has_value() ? std::optional{file->text()}
+                                       : (cache.has_value() ? embedded_text : std::nullopt);
+    if (text.has_value() && !options.recompute) {
+      result.answers = cache->lookup(day.name(), *text);
+      result.cached = result.answers.has_value();
+    }
+    if (!result.cached) {
+      auto input = aoc::embedded_input(day);
+      if (!input.has_value()) {
+        input = aoc::read_input(day, path, options.snapshot);
+      }
+      if (input.has_value()) {
+        const auto analysis = day.analyze(*input);
+        result.answers = aoc::Answers{.part1 = day.solve_part1(*input, analysis),
+                                      .part2 = day.solve_part2(*input, analysis)};
+        if (text.has_value()) {
+          cache->store(day.name(), *text, *result.answers);
+        }
+      }
+    }
+  }
+
+  result.wall = Seconds{Clock::now() - start}.count();
+  result.cpu = thread_cpu_time() + aoc::assisted_cpu_seconds() - cpu_start;
+  return result;
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: aoc_all [--threads N] [--snapshot] [--cache] [--recompute] "
+                         "[--stream] [--trace FILE] [DAY...]");
+    return 1;
+  }
+  if (options->trace_path.has_value()) {
+    aoc::trace::start();
+  }
+
+  auto days = aoc::registry() |
+              std::views::transform([](const auto& day) -> const aoc::Day* { return day.get(); }) |
+              std::views::filter([&](const aoc::Day* day) {
+                return options->days.empty() || std::ranges::contains(options->days, day->name());
+              }) |
+              std::ranges::to<std::vector>();
+  std::ranges::sort(days, {}, &aoc::Day::name);
+
+  const auto cache = options->use_cache ? aoc::ResultCache::open() : std::nullopt;
+  std::vector<Outcome> outcomes(days.size());
+  const auto origin = Clock::now();
+  {
+    aoc::ThreadPool pool{options->thread_count};
+    for (std::size_t i{}; i != days.size(); ++i) {
+      pool.submit([&, i] { outcomes[i] = run_day(*days[i], *options, cache, origin); });
+    }
+  }
+  const auto total_wall = Seconds{Clock::now() - origin}.count();
+  if (options->trace_path.has_value() && !aoc::trace::write(*options->trace_path)) {
+    std::println(stderr, "Cannot write {}", *options->trace_path);
+  }
+
+  for (const auto& [day, outcome] : std::views::zip(days, outcomes)) {
+    if (!outcome.answers.has_value()) {
+      std::println("{}: cannot read {}/input.txt", day->name(), day->name());
+      continue;
+    }
+    std::println("{}: part #1 {}", day->name(), outcome.answers->part1);
+    if (outcome.answers->part2.has_value()) {
+      std::println("{}: part #2 {}", day->name(), *outcome.answers->part2);
+    }
+  }
+
+  std::println("\n{:<6} {:>12} {:>12} {:>12}", "day", "start [ms]", "wall [ms]", "cpu [ms]");
+  for (const auto& [day, outcome] : std::views::zip(days, outcomes)) {
+    std::println("{:<6} {:>12.3f} {:>12.3f} {:>12.3f}{}", day->name(), outcome.start * 1e3,
+                 outcome.wall * 1e3, outcome.cpu * 1e3, outcome.cached ? "  cached" : "");
+  }
+
+  const auto serial_wall = std::ranges::fold_left(
+      outcomes, 0.0, [](const double acc, const Outcome& outcome) { return acc + outcome.wall; });
+  const auto critical = std::ranges::max_element(outcomes, {}, &Outcome::wall);
+  std::println("\nThreads: {}", options->thread_count);
+  std::println("Total wall time: {:.3f} ms (sum of days {:.3f} ms, speedup {:.2f}x)",
+               total_wall * 1e3, serial_wall * 1e3, serial_wall / total_wall);
+  if (critical != outcomes.end()) {
+    const auto& critical_day = days[std::size_t(std::distance(outcomes.begin(), critical))];
+    std::println("Critical path: {} ({:.3f} ms, {:.0f}% of total)", critical_day->name(),
+                 critical->wall * 1e3, 100.0 * critical->wall / total_wall);
+  }
+}
@@ -0,0 +1,114 @@
+// Replaces the global operator new and delete to count the allocations in aoc::memory. Linked into
+// aoc_bench with the AOC_TRACK_ALLOCATIONS option.
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "memory.hpp"
+
+namespace {
+
+auto allocate(std::size_t size) noexcept -> void* {
+  void* result = std::malloc(size == 0UZ ? 1UZ : size);
+  if (result != nullptr) {
+    aoc::memory::record_allocation(::malloc_usable_size(result));
+  }
+  return result;
+}
+
+auto allocate(std::size_t size, std::align_val_t alignment) noexcept -> void* {
+  const auto align = std::size_t(alignment);
+  // The size of aligned_alloc must be a multiple of the alignment
+  void* result = std::aligned_alloc(align, (std::max(size, 1UZ) + align - 1UZ) / align * align);
+  if (result != nullptr) {
+    aoc::memory::record_allocation(::malloc_usable_size(result));
+  }
+  return result;
+}
+
+auto deallocate(void* pointer) noexcept {
+  if (pointer != nullptr) {
+    aoc::memory::record_deallocation(::malloc_usable_size(pointer));
+    std::free(pointer);
+  }
+}
+
+template <typename... Alignment>
+auto allocate_or_throw(std::size_t size, Alignment... alignment) -> void* {
+  void* result = allocate(size, alignment...);
+  while (result == nullptr) {
+    const auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc{};
+    }
+    handler();
+    result = allocate(size, alignment...);
+  }
+  return result;
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cert-dcl54-cpp, misc-new-delete-overloads, hicpp-new-delete-operators)
+auto operator new(std::size_t size) -> void* { return allocate_or_throw(size); }
+auto operator new[](std::size_t size) -> void* { return allocate_or_throw(size); }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+  return allocate_or_throw(size, alignment);
+}
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+  return allocate_or_throw(size, alignment);
+}
+auto operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size);
+}
+auto operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size);
+}
+auto operator new(std::size_t size, std::align_val_t alignment,
+                  const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size, alignment);
+}
+auto operator new[](std::size_t size, std::align_val_t alignment,
+                    const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size, alignment);
+}
+
+auto operator delete(void* pointer) noexcept -> void { deallocate(pointer); }
+auto operator delete[](void* pointer) noexcept -> void { deallocate(pointer); }
+auto operator delete(void* pointer, std::size_t /*size*/) noexcept -> void { deallocate(pointer); }
+auto operator delete[](void* pointer, std::size_t /*size*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+    -> void {
+  deallocate(pointer);
+}
+auto operator delete[](void* pointer, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete(void* pointer, std::align_val_t /*alignment*/,
+                     const std::nothrow_t& /*tag*/) noexcept -> void {
+  deallocate(pointer);
+}
+auto operator delete[](void* pointer, std::align_val_t /*alignment*/,
+                       const std::nothrow_t& /*tag*/) noexcept -> void {
+  deallocate(pointer);
+}
+// NOLINTEND(cert-dcl54-cpp, misc-new-delete-overloads, hicpp-new-delete-operators)
@@ -0,0 +1,696 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <numbers>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "day.hpp"
+#include "generator.hpp"
+#include "input.hpp"
+#include "memory.hpp"
+#include "option_value.hpp"
+#include "parallel.hpp"
+#include "perf_counters.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+struct Options {
+  std::size_t warmup{1};
+  std::size_t iterations{10};
+  std::optional<std::string> json_path;
+  bool perf{};
+  bool memory{};
+  bool sweep{};
+  double max_exponent{1.5};
+  std::optional<std::string> save_baseline_path;
+  std::optional<std::string> baseline_path;  // To compare with
+  double threshold{0.1};
+  std::vector<std::string_view> days;
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    const auto next_value = [&]() -> std::optional<std::string_view> {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      return {*++it};
+    };
+    if (arg == "--warmup"sv || arg == "--iterations"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      const auto count = aoc::option_value<std::size_t>(arg, *value);
+      if (!count.has_value()) {
+        return std::nullopt;
+      }
+      if (arg == "--iterations"sv && *count == 0UZ) {
+        std::println(stderr, "At least one iteration is needed");
+        return std::nullopt;
+      }
+      (arg == "--warmup"sv ? result.warmup : result.iterations) = *count;
+    } else if (arg == "--json"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      result.json_path = std::string{*value};
+    } else if (arg == "--perf"sv) {
+      result.perf = true;
+    } else if (arg == "--memory"sv) {
+      result.memory = true;
+    } else if (arg == "--sweep"sv) {
+      result.sweep = true;
+    } else if (arg == "--max-exponent"sv || arg == "--threshold"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      const auto number = aoc::option_value<double>(arg, *value);
+      if (!number.has_value()) {
+        return std::nullopt;
+      }
+      if (!std::isfinite(*number) || (arg == "--threshold"sv && *number < 0.0)) {
+        std::println(stderr, "Invalid value for option {}: {}", arg, *value);
+        return std::nullopt;
+      }
+      if (arg == "--max-exponent"sv) {
+        result.max_exponent = *number;
+      } else {
+        result.threshold = *number / 100.0;
+      }
+    } else if (arg == "--save-baseline"sv || arg == "--compare"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      (arg == "--save-baseline"sv ? result.save_baseline_path : result.baseline_path) =
+          std::string{*value};
+    } else if (arg.starts_with("--"sv)) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      result.days.push_back(arg);
+    }
+  }
+  if (result.sweep && (result.save_baseline_path.has_value() || result.baseline_path.has_value())) {
+    std::println(stderr, "A sweep cannot be saved as or compared with a baseline");
+    return std::nullopt;
+  }
+  // Baselines hold the allocation counts when they are tracked
+  if (result.save_baseline_path.has_value() || result.baseline_path.has_value()) {
+    result.memory = result.memory || aoc::memory::tracking_allocations;
+  }
+  return result;
+}
+
+// Allocations per iteration, and peaks over all the iterations
+struct MemorySample {
+  std::optional<double> allocations;
+  std::optional<double> allocated_bytes;
+  std::optional<double> peak_live_bytes;  // Above what was live when the phase started
+  std::optional<double> peak_rss_bytes;
+};
+
+struct PhaseReport {
+  std::string_view phase;
+  std::vector<double> samples;  // Seconds, sorted
+  std::optional<aoc::PerfSample> perf;  // Per iteration
+  std::optional<MemorySample> memory;
+
+  auto min() const { return samples.front(); }
+  auto median() const { return samples[samples.size() / 2UZ]; }
+  auto p99() const {
+    const auto rank = std::size_t(std::ceil(0.99 * double(samples.size())));
+    return samples[std::max(rank, 1UZ) - 1UZ];
+  }
+};
+
+struct DayReport {
+  std::string_view day;
+  std::size_t input_bytes;
+  std::vector<PhaseReport> phases;
+};
+
+auto memory_sample(const aoc::memory::Allocations& before, std::size_t iterations,
+                   bool rss_reset) {
+  MemorySample result;
+  if constexpr (aoc::memory::tracking_allocations) {
+    const auto after = aoc::memory::allocations();
+    result.allocations = double(after.count - before.count) / double(iterations);
+    result.allocated_bytes = double(after.bytes - before.bytes) / double(iterations);
+    result.peak_live_bytes = double(after.peak_live_bytes - before.live_bytes);
+  }
+  if (rss_reset) {
+    result.peak_rss_bytes = aoc::memory::peak_rss().transform([](auto bytes) {
+      return double(bytes);
+    });
+  }
+  return result;
+}
+
+// The hardware counters, when given, run over all the timed iterations at once, and so do the
+// allocation counts
+template <typename Function>
+auto measure(std::string_view phase, const Options& options, aoc::PerfCounters* counters,
+             Function&& function) {
+  for (std::size_t i{}; i != options.warmup; ++i) {
+    std::invoke(function);
+  }
+  PhaseReport result{.phase = phase, .samples = {}, .perf = std::nullopt, .memory = std::nullopt};
+  result.samples.reserve(options.iterations);
+  const auto rss_reset = options.memory && aoc::memory::reset_peak_rss();
+  aoc::memory::reset_peak();
+  const auto allocations = aoc::memory::allocations();
+  if (counters != nullptr) {
+    counters->start();
+  }
+  for (std::size_t i{}; i != options.iterations; ++i) {
+    const auto start = Clock::now();
+    std::invoke(function);
+    result.samples.push_back(Seconds{Clock::now() - start}.count());
+  }
+  if (counters != nullptr) {
+    auto perf = counters->stop();
+    for (auto& count : perf.counts) {
+      if (count.has_value()) {
+        *count /= double(options.iterations);
+      }
+    }
+    result.perf = perf;
+  }
+  if (options.memory) {
+    result.memory = memory_sample(allocations, options.iterations, rss_reset);
+  }
+  std::ranges::sort(result.samples);
+  return result;
+}
+
+auto benchmark(const aoc::Day& day, std::string_view text, const Options& options,
+               aoc::PerfCounters* counters) {
+  DayReport result{.day = day.name(), .input_bytes = text.size(), .phases = {}};
+  const auto parse = [&] { return day.parse(text); };
+
+  result.phases.push_back(measure("parse"sv, options, counters, parse));
+
+  const auto input = parse();
+  if (day.has_snapshot()) {
+    // Loaded from memory, to time the decoding without the file system
+    aoc::SnapshotWriter writer;
+    day.save_snapshot(input, writer);
+    result.phases.push_back(measure("snapshot"sv, options, counters, [&] {
+      aoc::SnapshotReader reader{writer.bytes()};
+      return day.load_snapshot(reader);
+    }));
+  }
+
+  const auto analyze = [&] { return day.analyze(input); };
+  if (day.has_analysis()) {
+    result.phases.push_back(measure("analysis"sv, options, counters, analyze));
+  }
+
+  const auto analysis = analyze();
+  result.phases.push_back(measure("part1"sv, options, counters,
+                                  [&] { return day.solve_part1(input, analysis); }));
+  if (day.has_part2()) {
+    result.phases.push_back(measure("part2"sv, options, counters,
+                                    [&] { return day.solve_part2(input, analysis); }));
+  }
+  return result;
+}
+
+auto throughput(const DayReport& day, const PhaseReport& phase) {
+  return double(day.input_bytes) / phase.median();
+}
+
+auto print_text(std::span<const DayReport> reports) {
+  std::println("{:<6} {:<8} {:>12} {:>12} {:>12} {:>14}", "day", "phase", "min [ms]", "median [ms]",
+               "p99 [ms]", "input [MB/s]");
+  for (const auto& day : reports) {
+    for (const auto& phase : day.phases) {
+      std::println("{:<6} {:<8} {:>12.3f} {:>12.3f} {:>12.3f} {:>14.2f}", day.day, phase.phase,
+                   phase.min() * 1e3, phase.median() * 1e3, phase.p99() * 1e3,
+                   throughput(day, phase) / 1e6);
+    }
+  }
+}
+
+// Right-aligned in `width` columns, or a dash for what could not be counted
+auto perf_cell(std::optional<double> value, int width, int precision) {
+  return value.has_value() ? std::format("{:>{}.{}f}", *value, width, precision)
+                           : std::format("{:>{}}", "-", width);
+}
+
+auto percent(std::optional<double> rate) {
+  return rate.transform([](const double value) { return 100.0 * value; });
+}
+
+auto print_perf(std::span<const DayReport> reports) {
+  using aoc::PerfEvent;
+  std::println("\n{:<6} {:<8} {:>14} {:>14} {:>6} {:>14} {:>15} {:>12}", "day", "phase", "cycles",
+               "instructions", "IPC", "cache miss [%]", "branch miss [%]", "page faults");
+  for (const auto& day : reports) {
+    for (const auto& phase : day.phases) {
+      if (!phase.perf.has_value()) {
+        continue;
+      }
+      const auto& perf = *phase.perf;
+      std::println("{:<6} {:<8} {} {} {} {} {} {}", day.day, phase.phase,
+                   perf_cell(perf[PerfEvent::cycles], 14, 0),
+                   perf_cell(perf[PerfEvent::instructions], 14, 0), perf_cell(perf.ipc(), 6, 2),
+                   perf_cell(percent(perf.cache_miss_rate()), 14, 2),
+                   perf_cell(percent(perf.branch_miss_rate()), 15, 2),
+                   perf_cell(perf[PerfEvent::page_faults], 12, 1));
+    }
+  }
+}
+
+auto print_memory(std::span<const DayReport> reports) {
+  std::println("\n{:<6} {:<8} {:>12} {:>16} {:>16} {:>14}", "day", "phase", "allocations",
+               "allocated [kB]", "peak live [kB]", "peak RSS [MB]");
+  const auto scaled = [](std::optional<double> value, double unit) {
+    return value.transform([unit](const double bytes) { return bytes / unit; });
+  };
+  for (const auto& day : reports) {
+    for (const auto& phase : day.phases) {
+      if (!phase.memory.has_value()) {
+        continue;
+      }
+      const auto& memory = *phase.memory;
+      std::println("{:<6} {:<8} {} {} {} {}", day.day, phase.phase,
+                   perf_cell(memory.allocations, 12, 1),
+                   perf_cell(scaled(memory.allocated_bytes, 1e3), 16, 1),
+                   perf_cell(scaled(memory.peak_live_bytes, 1e3), 16, 1),
+                   perf_cell(scaled(memory.peak_rss_bytes, 1e6), 14, 1));
+    }
+  }
+}
+
+// Generated inputs double in size until a phase takes longer than this, or the generator's limit
+constexpr double sweep_budget{0.1};
+// Shorter phases are left out of the fits, their timings being mostly noise
+constexpr double sweep_floor{20e-6};
+
+auto sweep(const aoc::Day& day, const aoc::Generator& generator, const Options& options) {
+  std::vector<DayReport> result;
+  for (auto size = generator.min_size;; size *= 2UZ) {
+    const auto text = aoc::generate(generator, size, 0U);
+    result.push_back(benchmark(day, text, options, nullptr));
+    const auto slow = std::ranges::any_of(result.back().phases, [](const PhaseReport& phase) {
+      return phase.median() > sweep_budget;
+    });
+    if (slow || size > generator.max_size / 2UZ) {
+      break;
+    }
+  }
+  return result;
+}
+
+struct Fit {
+  std::string_view day;
+  std::string_view phase;
+  std::size_t point_count;  // Sizes at which the phase was long enough to be timed
+  std::size_t min_bytes;
+  std::size_t max_bytes;
+  std::optional<double> exponent;  // Of the input size in the median time
+};
+
+// Least-squares slope of log(time) over log(input size), for each phase of a sweep
+auto fit_exponents(std::span<const DayReport> points) {
+  std::vector<Fit> result;
+  for (const auto& phase : points.front().phases) {
+    std::vector<std::pair<double, double>> samples;
+    Fit fit{.day = points.front().day,
+            .phase = phase.phase,
+            .point_count = 0UZ,
+            .min_bytes = 0UZ,
+            .max_bytes = 0UZ,
+            .exponent = std::nullopt};
+    for (const auto& point : points) {
+      const auto it = std::ranges::find(point.phases, phase.phase, &PhaseReport::phase);
+      if (it != point.phases.end() && it->median() >= sweep_floor) {
+        samples.emplace_back(std::log(double(point.input_bytes)), std::log(it->median()));
+        fit.min_bytes = samples.size() == 1UZ ? point.input_bytes : fit.min_bytes;
+        fit.max_bytes = point.input_bytes;
+      }
+    }
+    fit.point_count = samples.size();
+    if (samples.size() >= 3UZ) {
+      const auto count = double(samples.size());
+      const auto mean_x = std::ranges::fold_left(samples | std::views::keys, 0.0, std::plus<>{}) /
+                          count;
+      const auto mean_y =
+          std::ranges::fold_left(samples | std::views::values, 0.0, std::plus<>{}) / count;
+      auto covariance = 0.0;
+      auto variance = 0.0;
+      for (const auto& [x, y] : samples) {
+        covariance += (x - mean_x) * (y - mean_y);
+        variance += (x - mean_x) * (x - mean_x);
+      }
+      if (variance > 0.0) {
+        fit.exponent = covariance / variance;
+      }
+    }
+    result.push_back(fit);
+  }
+  return result;
+}
+
+auto print_fits(std::span<const Fit> fits, double max_exponent) {
+  std::println("{:<6} {:<8} {:>7} {:>14} {:>14} {:>9}", "day", "phase", "points", "min input [B]",
+               "max input [B]", "exponent");
+  for (const auto& fit : fits) {
+    std::println("{:<6} {:<8} {:>7} {:>14} {:>14} {}", fit.day, fit.phase, fit.point_count,
+                 fit.min_bytes, fit.max_bytes, perf_cell(fit.exponent, 9, 2));
+  }
+  for (const auto& fit : fits) {
+    if (fit.exponent.has_value() && *fit.exponent > max_exponent) {
+      std::println(stderr, "Warning: {} {} grows as the input size to the power {:.2f}, above {}",
+                   fit.day, fit.phase, *fit.exponent, max_exponent);
+    }
+  }
+}
+
+// Baselines are text files with one line per phase: the day, the phase, the allocations per
+// iteration or a dash, the number of samples and the samples in seconds
+constexpr auto baseline_header = "aoc_bench baseline 1"sv;
+
+struct BaselinePhase {
+  std::string day;
+  std::string phase;
+  std::optional<double> allocations;
+  std::vector<double> samples;  // Sorted
+};
+
+auto write_baseline(std::ostream& out, std::span<const DayReport> reports) {
+  std::println(out, "{}", baseline_header);
+  for (const auto& day : reports) {
+    for (const auto& phase : day.phases) {
+      const auto allocations = phase.memory.and_then(&MemorySample::allocations);
+      std::print(out, "{} {} {} {}", day.day, phase.phase,
+                 allocations.has_value() ? std::format("{:e}", *allocations) : std::string{"-"},
+                 phase.samples.size());
+      for (const auto sample : phase.samples) {
+        std::print(out, " {:e}", sample);
+      }
+      std::println(out, "");
+    }
+  }
+}
+
+auto read_baseline(std::istream& in) -> std::optional<std::vector<BaselinePhase>> {
+  std::string line;
+  if (!std::getline(in, line) || line != baseline_header) {
+    return std::nullopt;
+  }
+  std::vector<BaselinePhase> result;
+  while (std::getline(in, line)) {
+    std::istringstream fields{line};
+    BaselinePhase phase;
+    std::string allocations;
+    std::size_t sample_count{};
+    if (!(fields >> phase.day >> phase.phase >> allocations >> sample_count)) {
+      return std::nullopt;
+    }
+    if (allocations != "-") {
+      double count{};
+      const auto* const last = allocations.data() + allocations.size();
+      if (const auto [end, error] = std::from_chars(allocations.data(), last, count);
+          error != std::errc{} || end != last) {
+        return std::nullopt;
+      }
+      phase.allocations = count;
+    }
+    // As many samples as announced, and at least one for the median
+    std::copy(std::istream_iterator<double>{fields}, std::istream_iterator<double>{},
+              std::back_inserter(phase.samples));
+    if (sample_count == 0UZ || phase.samples.size() != sample_count || !fields.eof()) {
+      return std::nullopt;
+    }
+    std::ranges::sort(phase.samples);
+    result.push_back(std::move(phase));
+  }
+  return result;
+}
+
+// One-sided Mann-Whitney U test: the probability that samples of the same distribution as
+// `baseline` rank at least as high as `current` does, from the normal approximation with the
+// corrections for ties and continuity. Unlike a comparison of means, it is not thrown off by the
+// few very slow iterations that preemptions cause.
+auto slower_p_value(std::span<const double> baseline, std::span<const double> current) {
+  std::vector<std::pair<double, bool>> pooled;  // Sample and whether it is a current one
+  std::ranges::transform(baseline, std::back_inserter(pooled),
+                         [](const double sample) { return std::pair{sample, false}; });
+  std::ranges::transform(current, std::back_inserter(pooled),
+                         [](const double sample) { return std::pair{sample, true}; });
+  std::ranges::sort(pooled);
+
+  auto current_rank_sum = 0.0;
+  auto tie_term = 0.0;
+  for (std::size_t first{}; first != pooled.size();) {
+    auto last = first;
+    while (last != pooled.size() && pooled[last].first == pooled[first].first) {
+      ++last;
+    }
+    const auto ties = double(last - first);
+    const auto rank = (double(first + last) + 1.0) / 2.0;  // Average of the 1-based ranks
+    current_rank_sum += rank * double(std::ranges::count(pooled.begin() + std::ptrdiff_t(first),
+                                                         pooled.begin() + std::ptrdiff_t(last),
+                                                         true, &std::pair<double, bool>::second));
+    tie_term += (ties * ties * ties) - ties;
+    first = last;
+  }
+
+  const auto n = double(current.size());
+  const auto m = double(baseline.size());
+  const auto total = n + m;
+  const auto u = current_rank_sum - (n * (n + 1.0) / 2.0);
+  const auto variance = n * m / 12.0 * ((total + 1.0) - (tie_term / (total * (total - 1.0))));
+  if (variance <= 0.0) {
+    return 1.0;
+  }
+  const auto z = (u - (n * m / 2.0) - 0.5) / std::sqrt(variance);
+  return 0.5 * std::erfc(z / std::numbers::sqrt2);
+}
+
+// Significance level of the test, which the slowdown must also exceed the threshold to fail
+constexpr double regression_alpha{0.01};
+
+auto median_of(std::span<const double> samples) { return samples[samples.size() / 2UZ]; }
+
+// Prints how each phase compares with the baseline, returning whether any regressed
+auto compare(std::span<const BaselinePhase> baseline, std::span<const DayReport> reports,
+             double threshold) {
+  std::println("{:<6} {:<8} {:>15} {:>15} {:>9} {:>9} {:>21}  {}", "day", "phase",
+               "baseline [ms]", "current [ms]", "change", "p-value", "allocations", "verdict");
+  auto regressed = false;
+  for (const auto& day : reports) {
+    for (const auto& phase : day.phases) {
+      const auto it = std::ranges::find_if(baseline, [&](const BaselinePhase& old) {
+        return old.day == day.day && old.phase == phase.phase;
+      });
+      if (it == baseline.end()) {
+        std::println("{:<6} {:<8} {:>15} {:>15.3f} {:>9} {:>9} {:>21}  new", day.day, phase.phase,
+                     "-", phase.median() * 1e3, "-", "-", "-");
+        continue;
+      }
+      const auto change = (phase.median() / median_of(it->samples)) - 1.0;
+      const auto p_value = slower_p_value(it->samples, phase.samples);
+      const auto allocations = phase.memory.and_then(&MemorySample::allocations);
+
+      std::string verdict{"ok"};
+      if (p_value < regression_alpha && change > threshold) {
+        verdict = "SLOWER";
+      } else if (slower_p_value(phase.samples, it->samples) < regression_alpha &&
+                 -change > threshold) {
+        verdict = "faster";
+      }
+      if (allocations.has_value() && it->allocations.has_value() &&
+          *allocations > (*it->allocations * (1.0 + threshold)) + 0.5) {
+        verdict = verdict == "SLOWER" ? "SLOWER, MORE ALLOCATIONS" : "MORE ALLOCATIONS";
+      }
+      regressed = regressed || (verdict != "ok" && verdict != "faster");
+
+      const auto allocation_cell =
+          allocations.has_value() && it->allocations.has_value()
+              ? std::format("{:.1f} -> {:.1f}", *it->allocations, *allocations)
+              : std::string{"-"};
+      std::println("{:<6} {:<8} {:>15.3f} {:>15.3f} {:>+8.1f}% {:>9.4f} {:>21}  {}", day.day,
+                   phase.phase, median_of(it->samples) * 1e3, phase.median() * 1e3,
+                   change * 100.0, p_value, allocation_cell, verdict);
+    }
+  }
+  for (const auto& old : baseline) {
+    const auto found = std::ranges::any_of(reports, [&](const DayReport& day) {
+      return day.day == old.day &&
+             std::ranges::contains(day.phases, old.phase, &PhaseReport::phase);
+    });
+    if (!found) {
+      std::println("{:<6} {:<8} {:>15.3f} {:>15} {:>9} {:>9} {:>21}  missing", old.day, old.phase,
+                   median_of(old.samples) * 1e3, "-", "-", "-", "-");
+    }
+  }
+  return regressed;
+}
+
+auto json_number(std::optional<double> value) {
+  return value.has_value() ? std::format("{:e}", *value) : std::string{"null"};
+}
+
+auto write_json(std::ostream& out, std::span<const DayReport> reports) {
+  std::print(out, "{{\n  \"days\": [");
+  for (const auto& [i, day] : std::views::enumerate(reports)) {
+    std::print(out, "{}\n    {{\"day\": \"{}\", \"input_bytes\": {}, \"phases\": [",
+               i == 0 ? "" : ",", day.day, day.input_bytes);
+    for (const auto& [j, phase] : std::views::enumerate(day.phases)) {
+      std::print(out,
+                 "{}\n      {{\"phase\": \"{}\", \"iterations\": {}, \"min_s\": {:e}, "
+                 "\"median_s\": {:e}, \"p99_s\": {:e}, \"bytes_per_s\": {:e}",
+                 j == 0 ? "" : ",", phase.phase, phase.samples.size(), phase.min(),
+                 phase.median(), phase.p99(), throughput(day, phase));
+      if (phase.perf.has_value()) {
+        using aoc::PerfEvent;
+        const auto& perf = *phase.perf;
+        std::print(out,
+                   ", \"perf\": {{\"cycles\": {}, \"instructions\": {}, \"ipc\": {}, "
+                   "\"cache_miss_rate\": {}, \"branch_miss_rate\": {}, \"page_faults\": {}}}",
+                   json_number(perf[PerfEvent::cycles]), json_number(perf[PerfEvent::instructions]),
+                   json_number(perf.ipc()), json_number(perf.cache_miss_rate()),
+                   json_number(perf.branch_miss_rate()), json_number(perf[PerfEvent::page_faults]));
+      }
+      if (phase.memory.has_value()) {
+        const auto& memory = *phase.memory;
+        std::print(out,
+                   ", \"memory\": {{\"allocations\": {}, \"allocated_bytes\": {}, "
+                   "\"peak_live_bytes\": {}, \"peak_rss_bytes\": {}}}",
+                   json_number(memory.allocations), json_number(memory.allocated_bytes),
+                   json_number(memory.peak_live_bytes), json_number(memory.peak_rss_bytes));
+      }
+      std::print(out, "}}");
+    }
+    std::print(out, "\n    ]}}");
+  }
+  std::print(out, "\n  ]\n}}\n");
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: aoc_bench [--warmup N] [--iterations N] [--json FILE] [--perf] "
+                         "[--memory] [DAY...]");
+    std::println(stderr, "       aoc_bench --sweep [--max-exponent X] [--warmup N] "
+                         "[--iterations N] [--json FILE] [DAY...]");
+    std::println(stderr, "       aoc_bench (--save-baseline FILE | --compare FILE "
+                         "[--threshold PCT]) [--warmup N] [--iterations N] [DAY...]");
+    return 1;
+  }
+
+  std::optional<std::vector<BaselinePhase>> baseline;
+  if (options->baseline_path.has_value()) {
+    std::ifstream in{*options->baseline_path};
+    baseline = read_baseline(in);
+    if (!baseline.has_value()) {
+      std::println(stderr, "Cannot read the baseline {}", *options->baseline_path);
+      return 1;
+    }
+  }
+
+  auto days = aoc::registry() |
+              std::views::transform([](const auto& day) -> const aoc::Day* { return day.get(); }) |
+              std::views::filter([&](const aoc::Day* day) {
+                return options->days.empty() || std::ranges::contains(options->days, day->name());
+              }) |
+              std::ranges::to<std::vector>();
+  std::ranges::sort(days, {}, &aoc::Day::name);
+
+  if (options->sweep) {
+    std::vector<DayReport> points;
+    std::vector<Fit> fits;
+    for (const aoc::Day* day : days) {
+      const auto* const generator = aoc::find_generator(day->name());
+      if (generator == nullptr) {
+        std::println(stderr, "No generator for {}, skipping it", day->name());
+        continue;
+      }
+      const auto day_points = sweep(*day, *generator, *options);
+      std::ranges::copy(fit_exponents(day_points), std::back_inserter(fits));
+      std::ranges::copy(day_points, std::back_inserter(points));
+    }
+    print_fits(fits, options->max_exponent);
+    if (options->json_path.has_value()) {
+      std::ofstream out{*options->json_path};
+      write_json(out, points);
+    }
+    return 0;
+  }
+
+  std::optional<aoc::PerfCounters> counters;
+  if (options->perf) {
+    counters.emplace();
+    if (!counters->available()) {
+      std::println(stderr, "Performance counters are unavailable, reporting timings only");
+      counters.reset();
+    } else {
+      // The counters only see the calling thread, so the parallel loops must not leave it
+      aoc::set_parallel_thread_count(1UZ);
+    }
+  }
+
+  std::vector<DayReport> reports;
+  for (const aoc::Day* day : days) {
+    const auto path = std::format("{}/input.txt", day->name());
+    const auto file = aoc::MappedFile::open(path);
+    if (!file.has_value()) {
+      std::println(stderr, "Cannot read {}, skipping {}", path, day->name());
+      continue;
+    }
+    reports.push_back(
+        benchmark(*day, file->text(), *options, counters.has_value() ? &*counters : nullptr));
+  }
+
+  if (options->save_baseline_path.has_value()) {
+    std::ofstream out{*options->save_baseline_path};
+    write_baseline(out, reports);
+  }
+  if (baseline.has_value()) {
+    return compare(*baseline, reports, options->threshold) ? 1 : 0;
+  }
+
+  print_text(reports);
+  if (counters.has_value()) {
+    print_perf(reports);
+  }
+  if (options->memory) {
+    print_memory(reports);
+  }
+  if (options->json_path.has_value()) {
+    std::ofstream out{*options->json_path};
+    write_json(out, reports);
+  }
+}
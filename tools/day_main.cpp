@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "day.hpp"
+#include "embedded.hpp"
+#include "input.hpp"
+#include "option_value.hpp"
+#include "result_cache.hpp"
+#include "stream.hpp"
+#include "thread_pool.hpp"
+#include "trace.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using Clock = std::chrono::steady_clock;
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+struct Options {
+  bool parallel{};
+  bool snapshot{};
+  bool use_cache{};
+  bool recompute{};
+  std::optional<std::string> trace_path;
+  bool stream{};
+  aoc::StreamOptions stream_options;
+  bool batch{};
+  std::size_t thread_count{std::max(std::thread::hardware_concurrency(), 1U)};
+  std::vector<std::string> paths;  // Of the batch, else read from stdin
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    if (arg == "--parallel"sv) {
+      result.parallel = true;
+    } else if (arg == "--snapshot"sv) {
+      result.snapshot = true;
+    } else if (arg == "--cache"sv) {
+      result.use_cache = true;
+    } else if (arg == "--recompute"sv) {
+      result.use_cache = result.recompute = true;
+    } else if (arg == "--trace"sv) {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      result.trace_path = std::string{*++it};
+    } else if (arg == "--stream"sv) {
+      result.stream = true;
+    } else if (arg == "--chunk-size"sv) {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      const auto size = aoc::option_value<std::size_t>(arg, *++it);
+      if (!size.has_value()) {
+        return std::nullopt;
+      }
+      result.stream_options.chunk_size = std::max(*size, 1UZ);
+    } else if (arg == "--batch"sv) {
+      result.batch = true;
+    } else if (arg == "--threads"sv) {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      const auto count = aoc::option_value<std::size_t>(arg, *++it);
+      if (!count.has_value()) {
+        return std::nullopt;
+      }
+      result.thread_count = std::max(*count, 1UZ);
+    } else if (arg.starts_with("--"sv) || !result.batch) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      result.paths.emplace_back(arg);
+    }
+  }
+  // Both parts are solved together for each input of a batch, and by the streaming solver
+  if (result.parallel && (result.batch || result.stream)) {
+    std::println(stderr, "--parallel cannot be combined with {}",
+                 result.batch ? "--batch" : "--stream");
+    return std::nullopt;
+  }
+  return result;
+}
+
+struct Outcome {
+  std::optional<std::string> answer;
+  double milliseconds{};
+};
+
+template <typename Solve>
+auto timed(Solve&& solve) {
+  const auto start = Clock::now();
+  std::optional<std::string> answer = solve();
+  return Outcome{.answer = std::move(answer),
+                 .milliseconds = Milliseconds{Clock::now() - start}.count()};
+}
+
+auto print_answer(int part, const std::optional<std::string>& answer) {
+  if (answer.has_value()) {
+    std::println("The answer to part #{} is {}", part, *answer);
+  }
+}
+
+// Answers for the input at `path`, or nothing if it cannot be read
+auto solve_file(const aoc::Day& day, const std::filesystem::path& path, const Options& options,
+                const std::optional<aoc::ResultCache>& cache) -> std::optional<aoc::Answers> {
+  if (const auto* streaming = options.stream ? aoc::find_streaming_day(day.name()) : nullptr;
+      streaming != nullptr) {
+    return streaming->solve(path, options.stream_options);
+  }
+  const auto text = cache.has_value() ? aoc::MappedFile::open(path) : std::nullopt;
+  if (text.has_value() && !options.recompute) {
+    if (auto answers = cache->lookup(day.name(), text->text()); answers.has_value()) {
+      return answers;
+    }
+  }
+  const auto input = aoc::read_input(day, path, options.snapshot);
+  if (!input.has_value()) {
+    return std::nullopt;
+  }
+  const auto analysis = day.analyze(*input);
+  aoc::Answers result{.part1 = day.solve_part1(*input, analysis),
+                      .part2 = day.solve_part2(*input, analysis)};
+  if (text.has_value()) {
+    cache->store(day.name(), text->text(), result);
+  }
+  return result;
+}
+
+// Solves every input of the batch in one process, the files being spread over a thread pool
+// whose workers keep their scratch arenas from one input to the next. Prints a line per file, in
+// the order of the batch: its path and both answers, tab-separated.
+auto solve_batch(const aoc::Day& day, const Options& options,
+                 const std::optional<aoc::ResultCache>& cache) {
+  auto paths = options.paths;
+  if (paths.empty()) {
+    for (std::string line; std::getline(std::cin, line);) {
+      if (!line.empty()) {
+        paths.push_back(std::move(line));
+      }
+    }
+  }
+
+  std::vector<std::optional<aoc::Answers>> answers(paths.size());
+  {
+    aoc::ThreadPool pool{std::min(options.thread_count, std::max(paths.size(), 1UZ))};
+    for (std::size_t i{}; i != paths.size(); ++i) {
+      pool.submit([&, i] { answers[i] = solve_file(day, paths[i], options, cache); });
+    }
+  }
+
+  auto result = 0;
+  for (std::size_t i{}; i != paths.size(); ++i) {
+    if (!answers[i].has_value()) {
+      std::println(stderr, "Cannot read {}", paths[i]);
+      result = 1;
+      continue;
+    }
+    std::println("{}\t{}\t{}", paths[i], answers[i]->part1, answers[i]->part2.value_or("-"));
+  }
+  return result;
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: main [--parallel | --stream [--chunk-size BYTES]] [--snapshot] "
+                         "[--cache] [--recompute] [--trace FILE]");
+    std::println(stderr, "       main --batch [--threads N] [--snapshot] [--cache] [--recompute] "
+                         "[--stream] [--chunk-size BYTES] [--trace FILE] [FILE...]");
+    return 1;
+  }
+  if (options->trace_path.has_value()) {
+    aoc::trace::start();
+  }
+  const auto write_trace = [&options] {
+    if (options->trace_path.has_value() && !aoc::trace::write(*options->trace_path)) {
+      std::println(stderr, "Cannot write {}", *options->trace_path);
+    }
+  };
+
+  assert(aoc::registry().size() == 1UZ);
+  const auto& day = *aoc::registry().front();
+
+  const auto cache = options->use_cache ? aoc::ResultCache::open() : std::nullopt;
+  if (options->batch) {
+    const auto result = solve_batch(day, *options, cache);
+    write_trace();
+    return result;
+  }
+
+  // The streaming solver reads the file itself, bypassing the cache and the snapshot
+  if (const auto* streaming = options->stream ? aoc::find_streaming_day(day.name()) : nullptr;
+      streaming != nullptr) {
+    const auto answers = streaming->solve("input.txt", options->stream_options);
+    if (!answers.has_value()) {
+      std::println(stderr, "Cannot read input.txt");
+      return 1;
+    }
+    print_answer(1, answers->part1);
+    print_answer(2, answers->part2);
+    write_trace();
+    return 0;
+  }
+
+  // An input compiled in with AOC_EMBED_INPUTS stands for input.txt
+  const auto embedded_text = aoc::embedded_text(day.name());
+  const auto file = cache.has_value() && !embedded_text.has_value()
+                        ? aoc::MappedFile::open("input.txt")
+                        : std::nullopt;
+  const auto text = file.has_value() ? std::optional{file->text()}
+                                     : (cache.has_value() ? embedded_text : std::nullopt);
+  if (text.has_value() && !options->recompute) {
+    if (const auto answers = cache->lookup(day.name(), *text); answers.has_value()) {
+      print_answer(1, answers->part1);
+      print_answer(2, answers->part2);
+      if (options->parallel) {
+        std::println(stderr, "The answers come from the cache, so the parts were not run (see "
+                             "--recompute)");
+      }
+      write_trace();
+      return 0;
+    }
+  }
+
+  auto maybe_input = aoc::embedded_input(day);
+  if (!maybe_input.has_value()) {
+    maybe_input = aoc::read_input(day, "input.txt", options->snapshot);
+  }
+  if (!maybe_input.has_value()) {
+    std::println(stderr, "Cannot read input.txt");
+    return 1;
+  }
+
+  const auto& input = *maybe_input;
+  const auto analysis = day.analyze(input);
+  const auto solve_part1 = [&] {
+    return timed([&] { return std::optional{day.solve_part1(input, analysis)}; });
+  };
+  const auto solve_part2 = [&] { return timed([&] { return day.solve_part2(input, analysis); }); };
+
+  Outcome part1;
+  Outcome part2;
+  if (!options->parallel) {
+    part1 = solve_part1();
+    print_answer(1, part1.answer);
+    part2 = solve_part2();
+    print_answer(2, part2.answer);
+  } else {
+    // Both parts only read the input and the analysis, so they run side by side
+    {
+      const std::jthread thread1{[&] { part1 = solve_part1(); }};
+      const std::jthread thread2{[&] { part2 = solve_part2(); }};
+    }
+    print_answer(1, part1.answer);
+    print_answer(2, part2.answer);
+    std::println(stderr, "Part #1 took {:.3f} ms", part1.milliseconds);
+    if (part2.answer.has_value()) {
+      std::println(stderr, "Part #2 took {:.3f} ms", part2.milliseconds);
+    }
+  }
+
+  if (text.has_value()) {
+    cache->store(day.name(), *text, aoc::Answers{.part1 = *part1.answer, .part2 = part2.answer});
+  }
+  write_trace();
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "day.hpp"
+#include "generator.hpp"
+#include "input.hpp"
+#include "reference.hpp"
+#include "result_cache.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+struct Options {
+  std::uint64_t seed{};
+  std::size_t cases{20};
+  std::vector<std::string_view> days;
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    const auto next_value = [&]() -> std::optional<std::string_view> {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      return {*++it};
+    };
+    if (arg == "--seed"sv || arg == "--cases"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      const auto number = std::stoull(std::string{*value});
+      if (arg == "--seed"sv) {
+        result.seed = number;
+      } else {
+        result.cases = number;
+      }
+    } else if (arg.starts_with("--"sv)) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      result.days.push_back(arg);
+    }
+  }
+  return result;
+}
+
+struct Run {
+  aoc::Answers answers;
+  double seconds{};  // Analysis and both parts, the parsing being shared
+};
+
+auto run(const aoc::Day& day, std::string_view text) {
+  const auto input = day.parse(text);
+  const auto start = Clock::now();
+  const auto analysis = day.analyze(input);
+  Run result;
+  result.answers = aoc::Answers{.part1 = day.solve_part1(input, analysis),
+                                .part2 = day.solve_part2(input, analysis)};
+  result.seconds = Seconds{Clock::now() - start}.count();
+  return result;
+}
+
+struct Comparison {
+  std::size_t cases{};
+  std::size_t mismatches{};
+  double reference_seconds{};
+  double optimized_seconds{};
+};
+
+// Runs both solvers on `text`, reporting a mismatch on stderr under `label`
+auto compare(const aoc::Day& reference, const aoc::Day& optimized, std::string_view text,
+             std::string_view label, Comparison& comparison) {
+  const auto expected = run(reference, text);
+  const auto actual = run(optimized, text);
+  ++comparison.cases;
+  comparison.reference_seconds += expected.seconds;
+  comparison.optimized_seconds += actual.seconds;
+  const auto report = [&](int part, std::string_view wanted, std::string_view got) {
+    std::println(stderr, "{} {}: part #{} is {} instead of {}", reference.name(), label, part, got,
+                 wanted);
+  };
+  auto mismatch = false;
+  if (actual.answers.part1 != expected.answers.part1) {
+    report(1, expected.answers.part1, actual.answers.part1);
+    mismatch = true;
+  }
+  if (actual.answers.part2 != expected.answers.part2) {
+    report(2, expected.answers.part2.value_or("-"), actual.answers.part2.value_or("-"));
+    mismatch = true;
+  }
+  if (mismatch) {
+    ++comparison.mismatches;
+  }
+}
+
+auto print_row(std::string_view day, std::string_view inputs, const Comparison& comparison) {
+  std::println("{:<6} {:<16} {:>16.3f} {:>16.3f} {:>9.1f}x  {}", day, inputs,
+               comparison.reference_seconds * 1e3, comparison.optimized_seconds * 1e3,
+               comparison.reference_seconds / comparison.optimized_seconds,
+               comparison.mismatches == 0UZ ? std::string{"ok"}
+                                            : std::format("{} mismatches", comparison.mismatches));
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: aoc_diff [--seed N] [--cases N] [DAY...]");
+    return 1;
+  }
+
+  auto references = aoc::references() |
+                    std::views::transform([](const auto& reference) { return &reference; }) |
+                    std::views::filter([&](const aoc::Reference* reference) {
+                      return options->days.empty() ||
+                             std::ranges::contains(options->days, reference->solver->name());
+                    }) |
+                    std::ranges::to<std::vector>();
+  std::ranges::sort(references, {},
+                    [](const aoc::Reference* reference) { return reference->solver->name(); });
+
+  std::println("{:<6} {:<16} {:>16} {:>16} {:>10}  {}", "day", "inputs", "reference [ms]",
+               "optimized [ms]", "speedup", "answers");
+  auto mismatches = 0UZ;
+  for (const aoc::Reference* reference : references) {
+    const auto& expected = *reference->solver;
+    const auto* const optimized = aoc::find_day(expected.name());
+    if (optimized == nullptr) {
+      std::println(stderr, "No optimized solver for {}", expected.name());
+      continue;
+    }
+
+    const auto path = std::format("{}/input.txt", expected.name());
+    if (const auto file = aoc::MappedFile::open(path); file.has_value()) {
+      Comparison comparison;
+      compare(expected, *optimized, file->text(), "input.txt", comparison);
+      print_row(expected.name(), "input.txt", comparison);
+      mismatches += comparison.mismatches;
+    } else {
+      std::println(stderr, "Cannot read {}, comparing {} on generated inputs only", path,
+                   expected.name());
+    }
+
+    const auto* const generator = aoc::find_generator(expected.name());
+    if (generator == nullptr || options->cases == 0UZ) {
+      continue;
+    }
+    // The sizes are drawn from the seed, and each case gets its own seed to replay it with aoc_gen
+    aoc::Random random{options->seed};
+    const auto max_size = std::min(generator->max_size, reference->max_generated_size);
+    Comparison comparison;
+    for (std::size_t i{}; i != options->cases; ++i) {
+      const auto size = random.uniform(generator->min_size, max_size);
+      const auto seed = random.next();
+      compare(expected, *optimized, aoc::generate(*generator, size, seed),
+              std::format("(aoc_gen --seed {} {} {})", seed, expected.name(), size), comparison);
+    }
+    print_row(expected.name(), std::format("{} generated", comparison.cases), comparison);
+    mismatches += comparison.mismatches;
+  }
+  return mismatches == 0UZ ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+// Registers the input compiled into the executables of a day with AOC_EMBED_INPUTS. Built once
+// per day, against the header generated from its input.txt.
+
+#include "embedded.hpp"
+#include "embedded_input.hpp"
+
+namespace {
+
+const auto registered = aoc::register_embedded_text(aoc::embedded::day, aoc::embedded::text);
+
+}  // namespace
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+struct Options {
+  bool list{};
+  std::uint64_t seed{};
+  std::optional<std::string> output_path;
+  std::vector<std::string_view> positionals;  // Day and size
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    const auto next_value = [&]() -> std::optional<std::string_view> {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      return {*++it};
+    };
+    if (arg == "--list"sv) {
+      result.list = true;
+    } else if (arg == "--seed"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      result.seed = std::stoull(std::string{*value});
+    } else if (arg == "--output"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      result.output_path = std::string{*value};
+    } else if (arg.starts_with("--"sv)) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      result.positionals.push_back(arg);
+    }
+  }
+  if (result.list ? !result.positionals.empty() : result.positionals.size() != 2UZ) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+auto print_list() {
+  auto generators = aoc::generators() | std::ranges::to<std::vector>();
+  std::ranges::sort(generators, {}, &aoc::Generator::day);
+  std::println("{:<6} {:>10} {:>12}  {}", "day", "min size", "max size", "size unit");
+  for (const auto& generator : generators) {
+    std::println("{:<6} {:>10} {:>12}  {}", generator.day, generator.min_size,
+                 generator.max_size == aoc::no_size_limit ? "-"
+                                                          : std::to_string(generator.max_size),
+                 generator.unit);
+  }
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: aoc_gen [--seed N] [--output FILE] DAY SIZE");
+    std::println(stderr, "       aoc_gen --list");
+    return 1;
+  }
+  if (options->list) {
+    print_list();
+    return 0;
+  }
+
+  const auto day = options->positionals[0];
+  const auto* const generator = aoc::find_generator(day);
+  if (generator == nullptr) {
+    std::println(stderr, "No generator for {}", day);
+    return 1;
+  }
+  const auto size = std::stoull(std::string{options->positionals[1]});
+  if (size < generator->min_size || size > generator->max_size) {
+    std::println(stderr, "The size of {} ({}) must lie between {} and {}", day, generator->unit,
+                 generator->min_size, generator->max_size);
+    return 1;
+  }
+
+  const auto text = aoc::generate(*generator, size, options->seed);
+  if (options->output_path.has_value()) {
+    std::ofstream out{*options->output_path, std::ios::binary};
+    out.write(text.data(), std::streamsize(text.size()));
+    out.close();
+    if (!out) {
+      std::println(stderr, "Cannot write {}", *options->output_path);
+      return 1;
+    }
+  } else if (std::fwrite(text.data(), 1UZ, text.size(), stdout) != text.size() ||
+             std::fflush(stdout) != 0) {
+    std::println(stderr, "Cannot write the standard output");
+    return 1;
+  }
+}
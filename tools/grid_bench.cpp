@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "generator.hpp"
+#include "grid.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using aoc::Idx;
+using aoc::Loc;
+
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+struct Options {
+  std::uint64_t seed{};
+  std::size_t iterations{3};
+  std::vector<Idx> sides;
+};
+
+auto parse_options(std::span<const char* const> args) -> std::optional<Options> {
+  Options result;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    const std::string_view arg{*it};
+    const auto next_value = [&]() -> std::optional<std::string_view> {
+      if (std::next(it) == args.end()) {
+        std::println(stderr, "Missing value for option {}", arg);
+        return std::nullopt;
+      }
+      return {*++it};
+    };
+    if (arg == "--seed"sv || arg == "--iterations"sv) {
+      const auto value = next_value();
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      const auto number = std::stoull(std::string{*value});
+      if (arg == "--seed"sv) {
+        result.seed = number;
+      } else {
+        result.iterations = std::max(number, 1ULL);
+      }
+    } else if (arg.starts_with("--"sv)) {
+      std::println(stderr, "Unknown option {}", arg);
+      return std::nullopt;
+    } else {
+      const auto side = std::stoi(std::string{arg});
+      if (side <= 0) {
+        std::println(stderr, "Invalid grid side {}", arg);
+        return std::nullopt;
+      }
+      result.sides.push_back(side);
+    }
+  }
+  if (result.sides.empty()) {
+    result.sides = {4096, 8192, 16384, 32768};
+  }
+  return result;
+}
+
+constexpr std::array<Loc, 4> steps{{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+constexpr std::uint8_t border{2};
+
+// Two kinds of plots, the second one drawn with a probability close to the percolation threshold
+// of the square lattice, so that the regions range from single cells to sprawling clusters
+template <typename Layout>
+auto make_grid(Idx side, std::uint64_t seed) {
+  aoc::Grid<std::uint8_t, Layout> result{side, side, std::uint8_t{}, border, Idx{1}};
+  aoc::Random random{seed};
+  for (Idx row{}; row != side; ++row) {
+    for (Idx col{}; col != side; ++col) {
+      result[Loc{row, col}] = random.chance(0.6) ? 1U : 0U;
+    }
+  }
+  return result;
+}
+
+template <typename Layout>
+auto row_scan(const aoc::Grid<std::uint8_t, Layout>& grid) {
+  std::uint64_t result{};
+  for (Idx row{}; row != grid.row_count(); ++row) {
+    for (Idx col{}; col != grid.col_count(); ++col) {
+      result = (result * 3U) + grid[Loc{row, col}];
+    }
+  }
+  return result;
+}
+
+template <typename Layout>
+auto column_scan(const aoc::Grid<std::uint8_t, Layout>& grid) {
+  std::uint64_t result{};
+  for (Idx col{}; col != grid.col_count(); ++col) {
+    for (Idx row{}; row != grid.row_count(); ++row) {
+      result = (result * 3U) + grid[Loc{row, col}];
+    }
+  }
+  return result;
+}
+
+// Breadth-first flood fill of every region, the access pattern of the plot and trail days
+template <typename Layout>
+auto flood_fill(const aoc::Grid<std::uint8_t, Layout>& grid) {
+  using Index = aoc::Grid<std::uint8_t, Layout>::Index;
+  aoc::Grid<std::uint8_t, Layout> seen{grid.row_count(), grid.col_count(), std::uint8_t{0},
+                                       std::uint8_t{1}, grid.padding()};
+  std::vector<Index> front;
+  std::vector<Index> next;
+  std::uint64_t result{};
+  for (Index start{}; start != grid.cell_count(); ++start) {
+    if (seen[start] != 0U) {
+      continue;
+    }
+    ++result;
+    seen[start] = 1U;
+    front.assign(1UZ, start);
+    while (!front.empty()) {
+      for (const auto index : front) {
+        for (const auto neighbor : grid.neighbors(index, steps)) {
+          if (seen[neighbor] == 0U && grid[neighbor] == grid[index]) {
+            seen[neighbor] = 1U;
+            next.push_back(neighbor);
+          }
+        }
+      }
+      std::swap(front, next);
+      next.clear();
+    }
+  }
+  return result;
+}
+
+// One walker per row taking side/16 random steps, bouncing off the border, like the guard and
+// robot days
+template <typename Layout>
+auto random_walks(const aoc::Grid<std::uint8_t, Layout>& grid, std::uint64_t seed) {
+  aoc::Random random{seed};
+  std::uint64_t result{};
+  for (Idx walker{}; walker != grid.row_count(); ++walker) {
+    Loc loc{.row = random.uniform(Idx{}, grid.row_count() - 1),
+            .col = random.uniform(Idx{}, grid.col_count() - 1)};
+    for (Idx step{}; step < grid.col_count() / 16; step += 32) {
+      auto directions = random.next();
+      for (auto i = 0U; i != 32U; ++i, directions >>= 2U) {
+        const auto next = loc + steps[directions & 3U];
+        if (grid[next] != border) {
+          loc = next;
+          result += grid[loc];
+        }
+      }
+    }
+  }
+  return result;
+}
+
+struct Measurement {
+  std::string_view kernel;
+  double seconds;
+  std::uint64_t result;  // Checksum, the same for every layout
+};
+
+template <typename Kernel>
+auto measure(std::string_view kernel, const Options& options, Kernel run) {
+  Measurement result{
+      .kernel = kernel, .seconds = std::numeric_limits<double>::infinity(), .result = 0U};
+  for (std::size_t i{}; i != options.iterations; ++i) {
+    const auto start = Clock::now();
+    result.result = run();
+    result.seconds = std::min(result.seconds, Seconds{Clock::now() - start}.count());
+  }
+  return result;
+}
+
+template <typename Layout>
+auto measure_layout(Idx side, const Options& options) {
+  const auto grid = make_grid<Layout>(side, options.seed);
+  return std::vector{
+      measure("row scan", options, [&] { return row_scan(grid); }),
+      measure("column scan", options, [&] { return column_scan(grid); }),
+      measure("flood fill", options, [&] { return flood_fill(grid); }),
+      measure("random walks", options, [&] { return random_walks(grid, options.seed); }),
+  };
+}
+
+}  // namespace
+
+auto main(int argc, const char* argv[]) -> int {
+  const auto options = parse_options({std::next(argv), std::size_t(argc - 1)});
+  if (!options.has_value()) {
+    std::println(stderr, "Usage: aoc_grid_bench [--seed N] [--iterations N] [SIDE...]");
+    return 1;
+  }
+
+  std::println("{:>6} {:<14} {:<10} {:>12} {:>10} {:>12}", "side", "kernel", "layout", "time [ms]",
+               "ns/cell", "vs row-major");
+  auto mismatches = 0UZ;
+  for (const auto side : options->sides) {
+    // One grid at a time, as the largest ones take a good part of the memory
+    const std::array<std::pair<std::string_view, std::vector<Measurement>>, 3> layouts{{
+        {"row-major", measure_layout<aoc::RowMajorLayout>(side, *options)},
+        {"tiled", measure_layout<aoc::TiledGridLayout>(side, *options)},
+        {"morton", measure_layout<aoc::MortonGridLayout>(side, *options)},
+    }};
+    const auto cell_count = double(side) * double(side);
+    for (std::size_t kernel{}; kernel != layouts.front().second.size(); ++kernel) {
+      const auto& baseline = layouts.front().second[kernel];
+      for (const auto& [layout, measurements] : layouts) {
+        const auto& measurement = measurements[kernel];
+        std::println("{:>6} {:<14} {:<10} {:>12.3f} {:>10.3f} {:>11.2f}x", side, measurement.kernel,
+                     layout, measurement.seconds * 1e3, measurement.seconds * 1e9 / cell_count,
+                     baseline.seconds / measurement.seconds);
+        if (measurement.result != baseline.result) {
+          std::println(stderr, "{} {} on side {}: checksum {} instead of {}", layout,
+                       measurement.kernel, side, measurement.result, baseline.result);
+          ++mismatches;
+        }
+      }
+    }
+  }
+  return mismatches == 0UZ ? 0 : 1;
+}